@@ -208,6 +208,13 @@ class literal : public expression {
     return value;
   }
 
+  /**
+   * @brief Get the scalar object.
+   *
+   * @return The scalar holding the value of this literal
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @brief Accepts a visitor class.
    *
@@ -29,6 +29,9 @@
 
 namespace cudf {
 namespace io {
+namespace detail::csv {
+class chunked_reader;
+}  // namespace detail::csv
 
 /**
  * @addtogroup io_readers
@@ -1302,6 +1305,80 @@ table_with_metadata read_csv(
   csv_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class to read a CSV dataset as a series of tables, one per byte
+ * range of the source.
+ *
+ * Each chunk reads the rows that start within its byte range, as `read_csv` does with a byte
+ * range, so that a row that spans two ranges is read whole by the first one. The column names and
+ * the selected columns are determined by the first chunk, and the column types by the first chunk
+ * that holds data rows; all later chunks have the same schema. Types that are not set in the
+ * options are inferred from that chunk only, so the types of columns whose values may not fit the
+ * inferred type in the rest of the source should be set.
+ *
+ * Only uncompressed sources are supported, and the options must not select rows with a byte
+ * range, `skiprows`, `skipfooter` or `nrows`.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of 256MB:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.csv");
+ *  auto options = cudf::io::csv_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_csv_reader(256 * 1024 * 1024, options);
+ *
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // ...
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_size Size of the byte range of the source read by each chunk
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_csv_reader(
+    std::size_t chunk_read_size,
+    csv_reader_options options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the next chunk of the dataset.
+   *
+   * Byte ranges without rows are skipped, except that a table is always returned by the first
+   * call, so that the schema is known even if the source is empty.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   *
+   * @return The next chunk as a set of columns along with metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
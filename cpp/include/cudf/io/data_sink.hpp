@@ -18,6 +18,7 @@
 
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -186,6 +187,18 @@ class data_sink {
     CUDF_FAIL("data_sink classes that support device_write_async must override it.");
   }
 
+  /**
+   * @brief Whether or not this sink can be written from a background thread.
+   *
+   * If this function returns true, the writers can call `host_write()` from a thread other than
+   * the caller's, to write the encoded data while they encode the next batch. Calls to the sink
+   * are never concurrent. Sinks that must be called from the caller's thread, e.g. sinks
+   * implemented in Python, should keep the default.
+   *
+   * @return bool If this sink supports writes from a background thread
+   */
+  [[nodiscard]] virtual bool supports_background_writes() const { return false; }
+
   /**
    * @pure @brief Flush the data written into the sink
    */
@@ -199,5 +212,82 @@ class data_sink {
   virtual size_t bytes_written() = 0;
 };
 
+/**
+ * @brief Sink that stores the written data in host memory, as a list of segments.
+ *
+ * Unlike a sink that appends to a `std::vector`, data already written is never reallocated or
+ * copied as the output grows: writes fill the current segment and continue in newly allocated
+ * ones. Writes larger than the segment size get a segment of their own size. The data can be
+ * accessed as a list of segments, or consolidated into a single buffer on demand.
+ *
+ * Pass a pointer to this sink in `sink_info` to use it with the writers.
+ */
+class segmented_host_buffer_sink : public data_sink {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param segment_size Minimum size of the allocated segments, in bytes
+   */
+  explicit segmented_host_buffer_sink(size_t segment_size = 64 * 1024 * 1024);
+
+  /**
+   * @brief Append the buffer content to the sink
+   *
+   * @param[in] data Pointer to the buffer to be written into the sink object
+   * @param[in] size Number of bytes to write
+   */
+  void host_write(void const* data, size_t size) override;
+
+  /**
+   * @brief Whether or not this sink can be written from a background thread; always true
+   *
+   * @return bool True
+   */
+  [[nodiscard]] bool supports_background_writes() const override { return true; }
+
+  /**
+   * @brief Flush the data written into the sink; no-op as the data is only kept in memory
+   */
+  void flush() override {}
+
+  /**
+   * @brief Returns the total number of bytes written into this sink
+   *
+   * @return size_t Total number of bytes written into this sink
+   */
+  size_t bytes_written() override { return _bytes_written; }
+
+  /**
+   * @brief Returns the written data, as a list of contiguous host memory ranges in write order
+   *
+   * The ranges are valid until the sink is consolidated or destroyed.
+   *
+   * @return Spans of the written data
+   */
+  [[nodiscard]] std::vector<host_span<uint8_t const>> segments() const;
+
+  /**
+   * @brief Moves the written data into a single buffer and returns it
+   *
+   * Segments are released as they are copied, so the peak memory use is the size of the data
+   * plus the size of one segment. Later writes are appended after the consolidated data.
+   *
+   * @return Span of all the written data, valid until the next call that modifies the sink
+   */
+  host_span<uint8_t const> consolidate();
+
+ private:
+  struct segment {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size;
+    size_t capacity;
+  };
+
+  size_t _segment_size;
+  size_t _bytes_written = 0;
+  std::vector<segment> _segments;
+};
+
 }  // namespace io
 }  // namespace cudf
@@ -32,6 +32,8 @@
 
 #include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -84,6 +86,14 @@ class datasource {
     }
   };
 
+  /**
+   * @brief Range of bytes in the source.
+   */
+  struct read_range {
+    size_t offset;  ///< Bytes from the start
+    size_t size;    ///< Bytes to read
+  };
+
   /**
    * @brief Creates a source from a file path.
    *
@@ -121,6 +131,21 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates sources from the entries of a ZIP archive.
+   *
+   * The archive is read into host memory and the selected entries are decompressed concurrently.
+   * Each returned source holds the uncompressed data of one entry; the sources can be read one at
+   * a time, or passed together to readers that read multiple sources as a single table.
+   *
+   * @param[in] archive Source of the ZIP archive
+   * @param[in] entry_names Names of the entries to read, in the order of the returned sources; all
+   * file entries of the archive if empty
+   * @return Constructed datasource objects, one per entry
+   */
+  static std::vector<std::unique_ptr<datasource>> create_from_zip_entries(
+    datasource* archive, std::vector<std::string> const& entry_names = {});
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -164,6 +189,45 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Asynchronously reads a selected range into a host buffer.
+   *
+   * Returns a future value that contains the data buffer. Calling `get()` method of the return
+   * value synchronizes this function. The source must outlive the read.
+   *
+   * The default implementation calls `host_read` on a process-wide thread pool, so it should only
+   * be used concurrently with other reads if `host_read` is thread-safe.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return The data buffer as a future value (can be smaller than size)
+   */
+  virtual std::future<std::unique_ptr<datasource::buffer>> host_read_async(size_t offset,
+                                                                           size_t size);
+
+  /**
+   * @brief Returns buffers with the data of multiple ranges of the source.
+   *
+   * The default implementation reads the ranges one at a time, with `host_read`. Sources with a
+   * high cost per read can override it to merge nearby ranges and to issue the reads in parallel,
+   * e.g. with `coalesced_host_read`.
+   *
+   * @param[in] ranges Ranges to read; can overlap and need not be sorted
+   *
+   * @return The data buffers, in the order of the ranges (each can be smaller than its range)
+   */
+  virtual std::vector<std::unique_ptr<datasource::buffer>> host_read_ranges(
+    std::vector<read_range> const& ranges)
+  {
+    std::vector<std::unique_ptr<datasource::buffer>> buffers;
+    buffers.reserve(ranges.size());
+    for (auto const& range : ranges) {
+      buffers.emplace_back(host_read(range.offset, range.size));
+    }
+    return buffers;
+  }
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -276,6 +340,16 @@ class datasource {
    */
   [[nodiscard]] virtual bool is_empty() const { return size() == 0; }
 
+  /**
+   * @brief Returns a key that identifies the current contents of the source.
+   *
+   * The key changes when the data in the source changes, so readers can use it to cache data
+   * derived from the source, such as parsed file metadata.
+   *
+   * @return Key of the source contents; an empty string if the contents cannot be identified
+   */
+  [[nodiscard]] virtual std::string cache_key() const { return {}; }
+
   /**
    * @brief Implementation for non owning buffer where datasource holds buffer until destruction.
    */
@@ -365,6 +439,23 @@ class datasource {
     void const* _data_ptr;
     size_t _size;
   };
+
+ protected:
+  /**
+   * @brief Reads multiple ranges of the source by merging nearby ranges and by issuing the merged
+   * reads in parallel.
+   *
+   * Ranges that are separated by at most `LIBCUDF_IO_COALESCE_GAP_SIZE` bytes (64KB by default)
+   * are read with a single `host_read` call, and the returned buffers share the data of the
+   * merged read. The merged reads are executed on a process-wide thread pool, so `host_read` must
+   * be thread-safe to use this function.
+   *
+   * @param[in] ranges Ranges to read; can overlap and need not be sorted
+   *
+   * @return The data buffers, in the order of the ranges (each can be smaller than its range)
+   */
+  std::vector<std::unique_ptr<datasource::buffer>> coalesced_host_read(
+    std::vector<read_range> const& ranges);
 };
 
 /**
@@ -452,6 +543,21 @@ class arrow_io_source : public datasource {
     return result.ValueOrDie();
   }
 
+  /**
+   * @brief Returns buffers with the data of multiple ranges of the `arrow` source.
+   *
+   * Nearby ranges are merged and the merged reads are issued in parallel, which limits the number
+   * of requests to high-latency file systems.
+   *
+   * @param ranges The ranges to read
+   * @return Buffers with the read data, in the order of the ranges
+   */
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    std::vector<read_range> const& ranges) override
+  {
+    return coalesced_host_read(ranges);
+  }
+
   /**
    * @brief Returns the size of the data in the `arrow` source.
    *
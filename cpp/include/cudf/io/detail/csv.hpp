@@ -41,6 +41,46 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Class to read a CSV dataset as a series of tables, one per byte range of the source.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a datasource
+   *
+   * @param chunk_read_size Size of the byte ranges of the source read by each chunk
+   * @param source Input `datasource` object to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_size,
+                          std::unique_ptr<cudf::io::datasource>&& source,
+                          csv_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
@@ -45,10 +45,15 @@ namespace parquet {
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing.
+   */
+  reader();
+
  public:
   /**
    * @brief Constructor from an array of datasources
@@ -78,6 +83,46 @@ class reader {
                            rmm::cuda_stream_view stream = cudf::default_stream_value);
 };
 
+/**
+ * @brief Class to read Parquet dataset data into a series of tables of bounded size.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * The chunks are computed from the metadata of the sources at construction.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each output table; 0 for no limit
+   * @param pass_read_limit Limit on the estimated device memory used to read each table; 0 for no
+   * limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::size_t pass_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk(
+    rmm::cuda_stream_view stream = cudf::default_stream_value) const;
+};
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
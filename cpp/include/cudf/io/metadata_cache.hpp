@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Counters of the process-wide file metadata cache.
+ */
+struct metadata_cache_stats {
+  std::size_t hits;       ///< Number of reads that found the file metadata in the cache
+  std::size_t misses;     ///< Number of reads of cacheable sources that had to parse the metadata
+  std::size_t evictions;  ///< Number of entries removed to stay within the capacity
+  std::size_t size;       ///< Current size of the cached entries, in bytes
+  std::size_t capacity;   ///< Capacity of the cache, in bytes
+};
+
+/**
+ * @brief Sets the capacity of the process-wide file metadata cache.
+ *
+ * The Parquet and ORC readers keep the parsed footers of file sources in this cache, keyed by the
+ * file path, size and modification time, so repeated reads of the same files skip the footer I/O
+ * and decoding. The size of an entry is an estimate of the host memory used by the decoded
+ * metadata, which is several times the size of the encoded metadata in the file. The CSV reader
+ * also keeps the seek index of gzip sources read with a byte range, so that subsequent byte ranges
+ * are decompressed from the closest checkpoint. Least recently used entries are evicted when the
+ * capacity is exceeded.
+ *
+ * The cache is disabled by default; the initial capacity can be set with the
+ * `LIBCUDF_METADATA_CACHE_SIZE` environment variable.
+ *
+ * @param capacity Capacity of the cache in bytes; zero disables the cache and clears it
+ */
+void set_metadata_cache_capacity(std::size_t capacity);
+
+/**
+ * @brief Returns the counters of the process-wide file metadata cache.
+ *
+ * @return Cache counters
+ */
+metadata_cache_stats get_metadata_cache_stats();
+
+/**
+ * @brief Removes all entries from the process-wide file metadata cache and resets its counters.
+ */
+void clear_metadata_cache();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -70,6 +73,9 @@ class orc_reader_options {
   // Columns that should be read as Decimal128
   std::vector<std::string> _decimal128_columns;
 
+  // Predicate used to skip stripes that cannot contain matching rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   friend orc_reader_options_builder;
 
   /**
@@ -158,6 +164,17 @@ class orc_reader_options {
    */
   std::vector<std::string> const& get_decimal128_columns() const { return _decimal128_columns; }
 
+  /**
+   * @brief Returns the predicate used to skip stripes, if set.
+   *
+   * @return Filter expression; `nullopt` if the option is not set
+   */
+  [[nodiscard]] std::optional<std::reference_wrapper<ast::expression const>> const& get_filter()
+    const
+  {
+    return _filter;
+  }
+
   // Setters
 
   /**
@@ -187,6 +204,7 @@ class orc_reader_options {
   void set_skip_rows(size_type rows)
   {
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or not _filter.has_value(), "Can't set skip_rows along with a filter");
     _skip_rows = rows;
   }
 
@@ -198,6 +216,7 @@ class orc_reader_options {
   void set_num_rows(size_type nrows)
   {
     CUDF_EXPECTS(nrows == -1 or _stripes.empty(), "Can't set both num_rows along with stripes");
+    CUDF_EXPECTS(nrows == -1 or not _filter.has_value(), "Can't set num_rows along with a filter");
     _num_rows = nrows;
   }
 
@@ -231,6 +250,28 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Sets the predicate used to skip stripes.
+   *
+   * Stripes whose column statistics show that no row can satisfy the predicate are not read. The
+   * stripe statistics are checked first, then the statistics of the row groups in the row index
+   * of the remaining stripes, when present. This is a pruning hint rather than an exact filter:
+   * all rows of the stripes that are read are returned. Column references of the expression are
+   * indices of the columns of the output table, and literals must have the same type as the
+   * columns they are compared to. Only the statistics of integral, floating-point, boolean, date
+   * and timestamp columns are used. Can be combined with the stripe selection.
+   *
+   * The expression must outlive the reads that use these options.
+   *
+   * @param filter Boolean filter expression
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    CUDF_EXPECTS(_skip_rows == 0, "Can't set a filter along with skip_rows");
+    CUDF_EXPECTS(_num_rows == -1, "Can't set a filter along with num_rows");
+    _filter = filter;
+  }
 };
 
 /**
@@ -350,6 +391,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the predicate used to skip stripes.
+   *
+   * @param filter Boolean filter expression
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -24,10 +25,12 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace cudf {
@@ -45,6 +48,23 @@ constexpr size_type default_max_page_size_rows  = 20000;       ///< 20k rows per
 
 class parquet_reader_options_builder;
 
+/**
+ * @brief Inclusive range of values of a single column, used to skip reading Parquet data pages.
+ *
+ * The bounds are compared against the per-page minimum and maximum values recorded in the page
+ * index of the file. Integral, boolean, date, and timestamp columns compare against `int64_t`
+ * bounds in the units stored in the file, floating-point columns against `double` bounds, and
+ * string columns against `std::string` bounds in byte-wise order. An unset bound leaves that side
+ * of the range open.
+ */
+struct parquet_page_filter {
+  using value_type = std::variant<int64_t, double, std::string>;  ///< Type of the range bounds
+
+  std::string column;             ///< Path of the leaf column, with nested names joined by '.'
+  std::optional<value_type> min;  ///< Inclusive lower bound of the range
+  std::optional<value_type> max;  ///< Inclusive upper bound of the range
+};
+
 /**
  * @brief Settings for `read_parquet()`.
  */
@@ -68,6 +88,11 @@ class parquet_reader_options {
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
+  // Range of values used to skip pages that cannot contain matching rows
+  std::optional<parquet_page_filter> _page_filter;
+  // Predicate used to skip row groups that cannot contain matching rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   /**
    * @brief Constructor from source info.
    *
@@ -156,6 +181,27 @@ class parquet_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns the range of values used to skip data pages, if set.
+   *
+   * @return Page filter; `nullopt` if the option is not set
+   */
+  [[nodiscard]] std::optional<parquet_page_filter> const& get_page_filter() const
+  {
+    return _page_filter;
+  }
+
+  /**
+   * @brief Returns the predicate used to skip row groups, if set.
+   *
+   * @return Filter expression; `nullopt` if the option is not set
+   */
+  [[nodiscard]] std::optional<std::reference_wrapper<ast::expression const>> const& get_filter()
+    const
+  {
+    return _filter;
+  }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -201,6 +247,9 @@ class parquet_reader_options {
     if ((val != 0) and (!_row_groups.empty())) {
       CUDF_FAIL("skip_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != 0) and (_page_filter.has_value() or _filter.has_value())) {
+      CUDF_FAIL("skip_rows can't be set along with a filter");
+    }
 
     _skip_rows = val;
   }
@@ -215,6 +264,9 @@ class parquet_reader_options {
     if ((val != -1) and (!_row_groups.empty())) {
       CUDF_FAIL("num_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != -1) and (_page_filter.has_value() or _filter.has_value())) {
+      CUDF_FAIL("num_rows can't be set along with a filter");
+    }
 
     _num_rows = val;
   }
@@ -225,6 +277,47 @@ class parquet_reader_options {
    * @param type The timestamp data_type to which all timestamp columns need to be cast
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets the range of values used to skip data pages.
+   *
+   * Row groups and data pages whose page index statistics show that they hold no value within the
+   * range are not read. This is a pruning hint rather than an exact filter: whole pages are read,
+   * all rows between the first and the last matching page are returned, and files without a page
+   * index are read in full.
+   *
+   * @param filter Column and range of values to read
+   */
+  void set_page_filter(parquet_page_filter filter)
+  {
+    if ((_skip_rows != 0) or (_num_rows != -1)) {
+      CUDF_FAIL("page filter can't be set along with skip_rows and num_rows");
+    }
+
+    _page_filter = std::move(filter);
+  }
+
+  /**
+   * @brief Sets the predicate used to skip row groups.
+   *
+   * Row groups whose column statistics show that no row can satisfy the predicate are not read.
+   * This is a pruning hint rather than an exact filter: the rows of the remaining row groups are
+   * all returned. Column references of the expression are indices of the columns of the output
+   * table, and literals must have the same type as the columns they are compared to. Only the
+   * statistics of fixed-width columns read as their natural type are used.
+   *
+   * The expression must outlive the reads that use these options.
+   *
+   * @param filter Boolean filter expression
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    if ((_skip_rows != 0) or (_num_rows != -1)) {
+      CUDF_FAIL("filter can't be set along with skip_rows and num_rows");
+    }
+
+    _filter = filter;
+  }
 };
 
 /**
@@ -332,6 +425,30 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the range of values used to skip data pages.
+   *
+   * @param filter Column and range of values to read
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& page_filter(parquet_page_filter filter)
+  {
+    options.set_page_filter(std::move(filter));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the predicate used to skip row groups.
+   *
+   * @param filter Boolean filter expression
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -367,6 +484,82 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked parquet reader class to read a Parquet dataset as a series of tables,
+ * chunk by chunk.
+ *
+ * The selection of the options is split into chunks whose estimated output size and working
+ * memory stay within the given limits, so that datasets larger than the device memory can be
+ * read. The estimates come from the compressed page sizes of the column chunks, which are read
+ * from the offset index of the file or, if it has none, from the page headers.
+ *
+ * Row groups of flat schemas are split at page boundaries. Row groups with list columns, and all
+ * row groups when the options select row groups or set a filter, are read whole; a chunk then
+ * exceeds the limits if a single row group does.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks of at most 1GB:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_parquet_reader(1024 * 1024 * 1024, 0, options);
+ *
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // ...
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each output table, in bytes; 0 for no
+   * limit
+   * @param pass_read_limit Limit on the estimated device memory used to read each table, including
+   * the compressed and decompressed page data, in bytes; 0 for no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource used to allocate device memory of the returned tables
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    std::size_t pass_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Check if there is any data that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the next chunk of the dataset.
+   *
+   * The first call returns a table even if the selection is empty, so that its schema is known.
+   *
+   * @throws cudf::logic_error If there is no data left to read
+   *
+   * @return The next chunk as a set of columns along with metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace jit {
+/**
+ * @addtogroup column_transformation
+ * @{
+ * @file
+ * @brief Management of the cache of JIT-compiled user-defined function kernels
+ *
+ * Kernels are compiled on their first use in a process, or loaded from the disk cache under
+ * `LIBCUDF_KERNEL_CACHE_PATH`. The disk cache is bounded to `LIBCUDF_KERNEL_CACHE_LIMIT_DISK`
+ * kernels, and to `LIBCUDF_KERNEL_CACHE_LIMIT_DISK_BYTES` bytes if set, evicting the least
+ * recently written files first.
+ */
+
+/**
+ * @brief Operation of a user-defined function kernel
+ */
+enum class udf_kernel_kind : int32_t {
+  BINARY_OPERATION,  ///< UDF of `cudf::binary_operation`
+  TRANSFORM,         ///< UDF of `cudf::transform`
+  ROLLING_WINDOW     ///< UDF aggregation of the rolling window functions
+};
+
+/**
+ * @brief Type of the windows of a rolling window UDF kernel
+ */
+enum class udf_window_type : int32_t {
+  FIXED,     ///< Fixed-size windows, as in `cudf::rolling_window` with window sizes
+  VARIABLE,  ///< Per-row windows, as in `cudf::rolling_window` with window columns
+  GROUPED    ///< Windows within groups, as in `cudf::grouped_rolling_window`
+};
+
+/**
+ * @brief Entry of a kernel warmup manifest, describing a UDF and the types it is applied to
+ */
+struct udf_kernel_spec {
+  udf_kernel_kind kind;                ///< Operation using the UDF
+  std::string udf;                     ///< PTX or CUDA source of the UDF
+  bool is_ptx;                         ///< Whether `udf` is PTX; binary operations require PTX
+  data_type output_type;               ///< Output type of the operation
+  std::vector<data_type> input_types;  ///< Types of the lhs and rhs, or of the input column
+  udf_window_type window_type = udf_window_type::FIXED;  ///< Windows of rolling window UDFs
+};
+
+/**
+ * @brief Counters of the UDF kernel cache of the process
+ */
+struct kernel_cache_statistics {
+  std::size_t hits;    ///< Kernel requests served by a kernel already loaded by the process
+  std::size_t misses;  ///< Kernel requests that compiled the kernel or loaded it from disk
+  std::chrono::nanoseconds compile_time;  ///< Total time spent on the misses
+};
+
+/**
+ * @brief Compiles, or loads from the disk cache, the kernels of a list of UDFs
+ *
+ * Later calls to the operations with the same UDFs and types use the loaded kernels. The kernels
+ * are compiled in parallel for the current device.
+ *
+ * @throws cudf::logic_error if an entry has the wrong number of input types, or if a binary
+ * operation UDF is not PTX
+ *
+ * @param manifest UDF kernels to load
+ * @param num_threads Number of kernels compiled concurrently; 0 for the number of hardware threads
+ */
+void warmup_udf_kernels(std::vector<udf_kernel_spec> const& manifest, int num_threads = 0);
+
+/**
+ * @brief Returns the counters of the UDF kernel cache of the process
+ *
+ * @return The cache statistics
+ */
+kernel_cache_statistics get_kernel_cache_statistics();
+
+/** @} */  // end of group
+}  // namespace jit
+}  // namespace cudf
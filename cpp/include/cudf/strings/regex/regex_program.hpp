@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/regex/flags.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @addtogroup strings_contains
+ * @{
+ */
+
+/**
+ * @brief Regex program compiled from a pattern, to be reused by the regex APIs.
+ *
+ * The APIs taking a pattern compile it on each call, reusing a program compiled earlier for the
+ * same pattern and flags when it is held by a cache of the most recently used programs. The
+ * number of programs in the cache is set by the `LIBCUDF_REGEX_PROGRAM_CACHE_SIZE` environment
+ * variable and defaults to 128; 0 disables the cache. Passing a `regex_program` to the APIs also
+ * skips the cache lookup.
+ *
+ * See the @ref md_regex "Regex Features" page for details on patterns supported by the APIs.
+ */
+struct regex_program {
+  struct regex_program_impl;
+
+  /**
+   * @brief Compiles a regex pattern into a program.
+   *
+   * @throw cudf::logic_error if the pattern is invalid
+   *
+   * @param pattern Regex pattern to compile
+   * @param flags Regex flags for interpreting special characters in the pattern
+   * @return Compiled program
+   */
+  static std::unique_ptr<regex_program> create(std::string_view pattern,
+                                               regex_flags flags = regex_flags::DEFAULT);
+
+  regex_program()                     = delete;
+  regex_program(regex_program const&) = delete;
+  regex_program& operator=(regex_program const&) = delete;
+
+  /**
+   * @brief Move constructor
+   *
+   * @param other Program to move from
+   */
+  regex_program(regex_program&& other) noexcept;
+
+  /**
+   * @brief Move assignment operator
+   *
+   * @param other Program to move from
+   * @return This program
+   */
+  regex_program& operator=(regex_program&& other) noexcept;
+
+  ~regex_program();
+
+  /**
+   * @brief Returns the pattern the program was compiled from
+   *
+   * @return Regex pattern
+   */
+  [[nodiscard]] std::string pattern() const;
+
+  /**
+   * @brief Returns the flags the program was compiled with
+   *
+   * @return Regex flags
+   */
+  [[nodiscard]] regex_flags flags() const;
+
+  /**
+   * @brief Returns the number of instructions of the program
+   *
+   * @return Instruction count
+   */
+  [[nodiscard]] int32_t instructions_count() const;
+
+  /**
+   * @brief Returns the number of capturing groups of the pattern
+   *
+   * @return Capturing group count
+   */
+  [[nodiscard]] int32_t groups_count() const;
+
+ private:
+  std::string _pattern;
+  regex_flags _flags;
+  std::unique_ptr<regex_program_impl> _impl;
+
+  regex_program(std::string_view pattern, regex_flags flags);
+
+  friend struct regex_device_builder;
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
@@ -22,10 +22,17 @@
 #include <librdkafka/rdkafkacpp.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -225,6 +232,284 @@ class kafka_consumer : public cudf::io::datasource {
   void consume_to_buffer();
 };
 
+/**
+ * @brief Range of messages to consume from a partition of a Kafka topic
+ */
+struct kafka_partition_range {
+  int partition;         ///< Partition index, between `0` and `TOPIC_NUM_PARTITIONS - 1` inclusive
+  int64_t start_offset;  ///< Offset of the first message to consume
+  int64_t end_offset;    ///< Offset past the last message to consume
+};
+
+/**
+ * @brief libcudf datasource that consumes several partitions of a Kafka topic concurrently
+ *
+ * Each partition is consumed on its own thread, by its own consumer, into its own buffer. The
+ * datasource exposes the buffers as a single source, in the order of the partition ranges, without
+ * joining them; reads that cross buffers are copied. The byte offsets of all consumed messages are
+ * recorded in an index.
+ *
+ * @ingroup io_datasources
+ */
+class kafka_partitioned_consumer : public cudf::io::datasource {
+ public:
+  /**
+   * @brief Consumes the messages of the given topic partitions.
+   *
+   * Documentation for librdkafka configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @throws cudf::logic_error if the configurations are invalid or `group.id` is missing
+   * @throws cudf::logic_error if consuming a partition fails with an error other than reaching its
+   * end or timing out
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka clients
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partitions ranges of messages to consume, one per partition
+   * @param batch_timeout maximum (millisecond) read time allowed for each partition. If the end
+   * offset is not reached before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output after each kafka message
+   */
+  kafka_partitioned_consumer(std::map<std::string, std::string> const& configs,
+                             python_callable_type python_callable,
+                             kafka_oauth_callback_wrapper_type callable_wrapper,
+                             std::string const& topic_name,
+                             std::vector<kafka_partition_range> const& partitions,
+                             int batch_timeout,
+                             std::string const& delimiter = "");
+
+  /**
+   * @brief Returns a buffer with a subset of the consumed data
+   *
+   * The buffer does not copy the data unless the range spans several partitions.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return The data buffer
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  /**
+   * @brief Reads a selected range into a preallocated buffer.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing host memory
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  /**
+   * @brief Returns the total size of the consumed data
+   *
+   * @return size_t The size of the source data in bytes
+   */
+  [[nodiscard]] size_t size() const override { return _buffer_offsets.back(); }
+
+  /**
+   * @brief Returns the byte offsets of the consumed messages in the source
+   *
+   * The offsets are in the order of the partition ranges, and followed by the size of the source,
+   * so that message `i` spans `[offsets[i], offsets[i + 1])`, including its delimiter.
+   *
+   * @return The message offsets
+   */
+  [[nodiscard]] std::vector<size_t> const& message_offsets() const { return _message_offsets; }
+
+  /**
+   * @brief Returns the number of messages consumed from each partition range
+   *
+   * @return The message counts, in the order of the partition ranges
+   */
+  [[nodiscard]] std::vector<int64_t> const& message_counts() const { return _message_counts; }
+
+ private:
+  std::vector<std::vector<char>> _buffers;    // Consumed data of each partition
+  std::vector<size_t> _buffer_offsets;        // Offset of each buffer in the source, then size
+  std::vector<size_t> _message_offsets;
+  std::vector<int64_t> _message_counts;
+};
+
+/**
+ * @brief Batch of messages consumed from a Kafka topic partition
+ *
+ * The payload of each message is followed by the delimiter of the reader that produced the batch.
+ *
+ * @ingroup io_datasources
+ */
+class kafka_batch : public cudf::io::datasource {
+ public:
+  /**
+   * @brief Constructs a batch from consumed data
+   *
+   * @param data Payloads of the messages, each followed by the delimiter
+   * @param message_offsets Offset of each message in `data`
+   * @param start_offset Kafka offset of the first message
+   * @param end_offset Kafka offset past the last message
+   */
+  kafka_batch(std::vector<char>&& data,
+              std::vector<size_t>&& message_offsets,
+              int64_t start_offset,
+              int64_t end_offset);
+
+  std::unique_ptr<cudf::io::datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+  /**
+   * @brief Returns the byte offsets of the messages in the batch, followed by the batch size
+   */
+  [[nodiscard]] std::vector<size_t> const& message_offsets() const { return _message_offsets; }
+
+  /**
+   * @brief Returns the Kafka offset of the first message of the batch
+   */
+  [[nodiscard]] int64_t start_offset() const { return _start_offset; }
+
+  /**
+   * @brief Returns the Kafka offset past the last message of the batch, to commit once processed
+   */
+  [[nodiscard]] int64_t end_offset() const { return _end_offset; }
+
+ private:
+  std::vector<char> _data;
+  std::vector<size_t> _message_offsets;
+  int64_t _start_offset;
+  int64_t _end_offset;
+};
+
+/**
+ * @brief Limits of the batches prefetched by a `kafka_prefetching_reader`
+ */
+struct kafka_prefetch_options {
+  int64_t batch_messages = 100'000;            ///< Maximum number of messages per batch
+  size_t batch_bytes     = 64 * 1024 * 1024;   ///< Maximum size of a batch, in bytes
+  int batch_timeout      = 1000;               ///< Milliseconds before a partial batch is ready
+  size_t max_batches     = 2;                  ///< Maximum number of prefetched batches
+  size_t max_bytes       = 256 * 1024 * 1024;  ///< Maximum size of the prefetched batches, in bytes
+};
+
+/**
+ * @brief Consumption metrics of a `kafka_prefetching_reader`
+ */
+struct kafka_prefetch_metrics {
+  int64_t lag;                 ///< Messages between the next offset to consume and the high end
+  int64_t messages_consumed;   ///< Total number of consumed messages
+  size_t bytes_consumed;       ///< Total size of the consumed messages, in bytes
+  double messages_per_second;  ///< Average consumption rate, in messages per second
+  double bytes_per_second;     ///< Average consumption rate, in bytes per second
+  size_t prefetched_batches;   ///< Number of batches ready to be returned
+};
+
+/**
+ * @brief Reads a Kafka topic partition as a series of batches, consumed in the background
+ *
+ * A background thread polls the partition and fills the next batches while the current one is
+ * processed, up to the depth and byte limits of the options. A batch is ready once it reaches its
+ * message or byte limit, or its timeout expires with at least one message.
+ */
+class kafka_prefetching_reader {
+ public:
+  /**
+   * @brief Starts consuming a range of messages of a topic partition.
+   *
+   * @throws cudf::logic_error if the configurations are invalid or `group.id` is missing
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partition partition index to consume from
+   * @param start_offset offset of the first message to consume
+   * @param end_offset offset past the last message to consume; consumption never ends if it is
+   * larger than the offsets of the messages ever produced, unless `enable.partition.eof` is set
+   * @param delimiter delimiter to insert into the output after each kafka message, Ex: "\n"
+   * @param options limits of the prefetched batches
+   */
+  kafka_prefetching_reader(std::map<std::string, std::string> const& configs,
+                           python_callable_type python_callable,
+                           kafka_oauth_callback_wrapper_type callable_wrapper,
+                           std::string const& topic_name,
+                           int partition,
+                           int64_t start_offset,
+                           int64_t end_offset,
+                           std::string const& delimiter,
+                           kafka_prefetch_options const& options = {});
+
+  /**
+   * @brief Stops the background consumption and closes the consumer
+   */
+  ~kafka_prefetching_reader();
+
+  /**
+   * @brief Returns whether there are batches left to read
+   *
+   * @return `false` once the end offset, or the end of the partition, is reached and all batches
+   * were returned
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the next batch, waiting for it if it is not prefetched yet
+   *
+   * @throws cudf::logic_error if the consumption failed, or there are no batches left
+   *
+   * @return The next batch of messages
+   */
+  std::unique_ptr<kafka_batch> next_batch();
+
+  /**
+   * @brief Returns the current consumption metrics
+   *
+   * @return The metrics
+   */
+  [[nodiscard]] kafka_prefetch_metrics metrics() const;
+
+ private:
+  /**
+   * @brief Polls the partition until the end offset is reached or the reader is destroyed
+   */
+  void consume_batches();
+
+  std::unique_ptr<python_oauth_refresh_callback> oauth_cb;
+  std::unique_ptr<RdKafka::Conf> kafka_conf;
+  std::unique_ptr<RdKafka::KafkaConsumer> consumer;
+
+  std::string topic_name;
+  int partition;
+  int64_t end_offset;
+  std::string delimiter;
+  kafka_prefetch_options options;
+
+  mutable std::mutex mutex;
+  std::condition_variable batch_ready;  // A batch was queued, or the consumption ended
+  std::condition_variable batch_taken;  // A batch was returned, or the reader is stopping
+  std::deque<std::unique_ptr<kafka_batch>> batches;
+  size_t prefetched_bytes = 0;
+  bool done               = false;  // The consumption reached the end offset or failed
+  std::atomic<bool> stopping{false};
+  std::exception_ptr error;
+
+  // Metrics, updated by the background thread
+  int64_t next_offset;
+  int64_t high_watermark    = 0;
+  int64_t messages_consumed = 0;
+  size_t bytes_consumed     = 0;
+  std::chrono::steady_clock::time_point consumption_start;
+
+  std::thread poller;
+};
+
 }  // namespace kafka
 }  // namespace external
 }  // namespace io
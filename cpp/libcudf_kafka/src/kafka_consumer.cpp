@@ -17,13 +17,118 @@
 
 #include <librdkafka/rdkafkacpp.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <future>
 #include <memory>
 
 namespace cudf {
 namespace io {
 namespace external {
 namespace kafka {
+namespace {
+
+/**
+ * @brief Creates a librdkafka configuration from key/value pairs
+ */
+std::unique_ptr<RdKafka::Conf> make_kafka_conf(std::map<std::string, std::string> const& configs,
+                                               RdKafka::OAuthBearerTokenRefreshCb* oauth_cb)
+{
+  auto conf = std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+  for (auto const& key_value : configs) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+
+  if (oauth_cb != nullptr) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   conf->set("oauthbearer_token_refresh_cb", oauth_cb, error_string),
+                 "Failed to set Kafka oauth callback");
+  }
+
+  // Kafka 0.9 > requires group.id in the configuration
+  std::string conf_val;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == conf->get("group.id", conf_val),
+               "Kafka group.id must be configured");
+  return conf;
+}
+
+/**
+ * @brief Assigns a single topic partition to a consumer, starting at the given offset
+ */
+void assign_partition(RdKafka::KafkaConsumer* consumer,
+                      std::string const& topic_name,
+                      int partition,
+                      int64_t offset)
+{
+  std::vector<RdKafka::TopicPartition*> topic_partitions{
+    RdKafka::TopicPartition::create(topic_name, partition, offset)};
+  auto const err = consumer->assign(topic_partitions);
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  CUDF_EXPECTS(err == RdKafka::ErrorCode::ERR_NO_ERROR, "Failed to assign Kafka topic partition");
+}
+
+/**
+ * @brief Messages consumed from a single partition
+ */
+struct partition_messages {
+  std::vector<char> buffer;
+  std::vector<size_t> offsets;  // Offset of each message in the buffer
+};
+
+/**
+ * @brief Consumes a range of messages of a partition, appending the delimiter to each message
+ */
+partition_messages consume_partition(RdKafka::KafkaConsumer* consumer,
+                                     std::string const& topic_name,
+                                     kafka_partition_range range,
+                                     int batch_timeout,
+                                     std::string const& delimiter)
+{
+  // Upper bound of the initial buffer allocation
+  constexpr size_t max_reserved_size = 256 * 1024 * 1024;
+
+  assign_partition(consumer, topic_name, range.partition, range.start_offset);
+
+  partition_messages messages;
+  auto const num_messages = range.end_offset - range.start_offset;
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+  // Offsets can have gaps, e.g. in compacted topics, so the range ends at an offset rather than
+  // after a number of messages
+  auto next_offset = range.start_offset;
+  while (next_offset < range.end_offset && end > std::chrono::steady_clock::now()) {
+    auto const timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+      end - std::chrono::steady_clock::now());
+    std::unique_ptr<RdKafka::Message> msg{consumer->consume(timeout.count())};
+
+    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+      if (msg->offset() >= range.end_offset) { break; }
+      next_offset             = msg->offset() + 1;
+      auto const message_size = msg->len() + delimiter.size();
+      if (messages.buffer.capacity() == 0) {
+        // Size the buffer for the whole range, assuming that messages have similar sizes
+        messages.buffer.reserve(std::min<size_t>(message_size * num_messages, max_reserved_size));
+        messages.offsets.reserve(std::min<size_t>(num_messages, max_reserved_size));
+      }
+      messages.offsets.push_back(messages.buffer.size());
+      auto const payload = static_cast<char const*>(msg->payload());
+      messages.buffer.insert(messages.buffer.end(), payload, payload + msg->len());
+      messages.buffer.insert(messages.buffer.end(), delimiter.begin(), delimiter.end());
+    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      // If there are no more messages return
+      break;
+    } else if (msg->err() != RdKafka::ErrorCode::ERR__TIMED_OUT) {
+      CUDF_FAIL("Failed to consume Kafka messages: " + msg->errstr());
+    }
+  }
+  return messages;
+}
+
+}  // namespace
 
 kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                python_callable_type python_callable,
@@ -262,6 +367,299 @@ void kafka_consumer::close(int timeout)
   kafka_conf.reset(nullptr);
 }
 
+kafka_partitioned_consumer::kafka_partitioned_consumer(
+  std::map<std::string, std::string> const& configs,
+  python_callable_type python_callable,
+  kafka_oauth_callback_wrapper_type callable_wrapper,
+  std::string const& topic_name,
+  std::vector<kafka_partition_range> const& partitions,
+  int batch_timeout,
+  std::string const& delimiter)
+{
+  python_oauth_refresh_callback oauth_cb(callable_wrapper, python_callable);
+  auto const conf = make_kafka_conf(configs, python_callable != nullptr ? &oauth_cb : nullptr);
+
+  // One consumer per partition, so that the partitions are polled independently
+  std::vector<std::unique_ptr<RdKafka::KafkaConsumer>> consumers;
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    std::string errstr;
+    consumers.emplace_back(RdKafka::KafkaConsumer::create(conf.get(), errstr));
+    CUDF_EXPECTS(consumers.back() != nullptr, "Failed to create Kafka consumer: " + errstr);
+  }
+
+  std::vector<std::future<partition_messages>> tasks;
+  for (size_t i = 0; i < partitions.size(); ++i) {
+    tasks.push_back(std::async(std::launch::async,
+                               consume_partition,
+                               consumers[i].get(),
+                               std::cref(topic_name),
+                               partitions[i],
+                               batch_timeout,
+                               std::cref(delimiter)));
+  }
+  // Wait for all partitions before rethrowing, as the tasks use the consumers
+  for (auto const& task : tasks) {
+    task.wait();
+  }
+
+  _buffer_offsets.push_back(0);
+  for (auto& task : tasks) {
+    auto messages            = task.get();
+    auto const buffer_offset = _buffer_offsets.back();
+    std::transform(messages.offsets.cbegin(),
+                   messages.offsets.cend(),
+                   std::back_inserter(_message_offsets),
+                   [&](auto offset) { return buffer_offset + offset; });
+    _message_counts.push_back(messages.offsets.size());
+    _buffer_offsets.push_back(buffer_offset + messages.buffer.size());
+    _buffers.push_back(std::move(messages.buffer));
+  }
+  _message_offsets.push_back(_buffer_offsets.back());
+
+  for (auto& consumer : consumers) {
+    consumer->close();
+  }
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_partitioned_consumer::host_read(size_t offset,
+                                                                                    size_t size)
+{
+  offset = std::min(offset, this->size());
+  size   = std::min(size, this->size() - offset);
+  if (size == 0) { return std::make_unique<non_owning_buffer>(); }
+
+  auto const buffer_idx =
+    std::upper_bound(_buffer_offsets.cbegin(), _buffer_offsets.cend(), offset) -
+    _buffer_offsets.cbegin() - 1;
+  if (offset + size <= _buffer_offsets[buffer_idx + 1]) {
+    auto const data = _buffers[buffer_idx].data() + (offset - _buffer_offsets[buffer_idx]);
+    return std::make_unique<non_owning_buffer>(reinterpret_cast<uint8_t*>(data), size);
+  }
+
+  // The range spans several partitions
+  std::vector<uint8_t> data(size);
+  host_read(offset, size, data.data());
+  return buffer::create(std::move(data));
+}
+
+size_t kafka_partitioned_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  offset = std::min(offset, this->size());
+  size   = std::min(size, this->size() - offset);
+
+  auto buffer_idx = std::upper_bound(_buffer_offsets.cbegin(), _buffer_offsets.cend(), offset) -
+                    _buffer_offsets.cbegin() - 1;
+  size_t read_size = 0;
+  while (read_size < size) {
+    auto const buffer_offset = offset + read_size - _buffer_offsets[buffer_idx];
+    auto const to_copy = std::min(size - read_size, _buffers[buffer_idx].size() - buffer_offset);
+    std::memcpy(dst + read_size, _buffers[buffer_idx].data() + buffer_offset, to_copy);
+    read_size += to_copy;
+    ++buffer_idx;
+  }
+  return read_size;
+}
+
+kafka_batch::kafka_batch(std::vector<char>&& data,
+                         std::vector<size_t>&& message_offsets,
+                         int64_t start_offset,
+                         int64_t end_offset)
+  : _data(std::move(data)),
+    _message_offsets(std::move(message_offsets)),
+    _start_offset(start_offset),
+    _end_offset(end_offset)
+{
+  _message_offsets.push_back(_data.size());
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_batch::host_read(size_t offset, size_t size)
+{
+  offset = std::min(offset, _data.size());
+  size   = std::min(size, _data.size() - offset);
+  return std::make_unique<non_owning_buffer>(reinterpret_cast<uint8_t*>(_data.data()) + offset,
+                                             size);
+}
+
+size_t kafka_batch::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  offset = std::min(offset, _data.size());
+  size   = std::min(size, _data.size() - offset);
+  std::memcpy(dst, _data.data() + offset, size);
+  return size;
+}
+
+kafka_prefetching_reader::kafka_prefetching_reader(
+  std::map<std::string, std::string> const& configs,
+  python_callable_type python_callable,
+  kafka_oauth_callback_wrapper_type callable_wrapper,
+  std::string const& topic_name,
+  int partition,
+  int64_t start_offset,
+  int64_t end_offset,
+  std::string const& delimiter,
+  kafka_prefetch_options const& options)
+  : oauth_cb(std::make_unique<python_oauth_refresh_callback>(callable_wrapper, python_callable)),
+    kafka_conf(make_kafka_conf(configs, python_callable != nullptr ? oauth_cb.get() : nullptr)),
+    topic_name(topic_name),
+    partition(partition),
+    end_offset(end_offset),
+    delimiter(delimiter),
+    options(options),
+    next_offset(start_offset)
+{
+  CUDF_EXPECTS(options.max_batches > 0, "At least one batch must be prefetched");
+  CUDF_EXPECTS(options.batch_messages > 0, "Batches must contain at least one message");
+
+  std::string errstr;
+  consumer.reset(RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
+  CUDF_EXPECTS(consumer != nullptr, "Failed to create Kafka consumer: " + errstr);
+  assign_partition(consumer.get(), topic_name, partition, start_offset);
+
+  consumption_start = std::chrono::steady_clock::now();
+  poller            = std::thread(&kafka_prefetching_reader::consume_batches, this);
+}
+
+kafka_prefetching_reader::~kafka_prefetching_reader()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  batch_taken.notify_all();
+  poller.join();
+  consumer->close();
+}
+
+void kafka_prefetching_reader::consume_batches()
+{
+  // Upper bound of a poll, so that the thread notices quickly that the reader is stopping
+  constexpr auto max_poll_time = std::chrono::milliseconds(100);
+
+  try {
+    int64_t offset     = next_offset;
+    bool partition_end = false;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        batch_taken.wait(lock, [&] {
+          return stopping or
+                 (batches.size() < options.max_batches and prefetched_bytes < options.max_bytes);
+        });
+        if (stopping or offset >= end_offset or partition_end) { break; }
+      }
+
+      auto const batch_start = offset;
+      std::vector<char> data;
+      std::vector<size_t> message_offsets;
+      auto batch_deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(options.batch_timeout);
+      while (offset < end_offset and
+             static_cast<int64_t>(message_offsets.size()) < options.batch_messages and
+             data.size() < options.batch_bytes and not stopping) {
+        auto const now = std::chrono::steady_clock::now();
+        if (now >= batch_deadline) {
+          if (not message_offsets.empty()) { break; }
+          // Keep polling until the batch has at least one message
+          batch_deadline = now + std::chrono::milliseconds(options.batch_timeout);
+        }
+        auto const timeout = std::min<std::chrono::milliseconds>(
+          std::chrono::duration_cast<std::chrono::milliseconds>(batch_deadline - now),
+          max_poll_time);
+        std::unique_ptr<RdKafka::Message> msg{consumer->consume(timeout.count())};
+
+        if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+          if (msg->offset() >= end_offset) {
+            offset = end_offset;
+            break;
+          }
+          auto const message_size = msg->len() + delimiter.size();
+          if (data.capacity() == 0) {
+            // Size the buffer for the whole batch, assuming that messages have similar sizes
+            data.reserve(std::min<size_t>(message_size * options.batch_messages,
+                                          options.batch_bytes + message_size));
+          }
+          message_offsets.push_back(data.size());
+          auto const payload = static_cast<char const*>(msg->payload());
+          data.insert(data.end(), payload, payload + msg->len());
+          data.insert(data.end(), delimiter.begin(), delimiter.end());
+          offset = msg->offset() + 1;
+        } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+          // No more messages are available
+          partition_end = true;
+          break;
+        } else if (msg->err() != RdKafka::ErrorCode::ERR__TIMED_OUT) {
+          CUDF_FAIL("Failed to consume Kafka messages: " + msg->errstr());
+        }
+      }
+
+      int64_t low  = 0;
+      int64_t high = 0;
+      auto const watermark_err =
+        consumer->get_watermark_offsets(topic_name, partition, &low, &high);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        next_offset = offset;
+        if (watermark_err == RdKafka::ErrorCode::ERR_NO_ERROR) { high_watermark = high; }
+        messages_consumed += message_offsets.size();
+        bytes_consumed += data.size();
+        if (not message_offsets.empty()) {
+          prefetched_bytes += data.size();
+          batches.push_back(std::make_unique<kafka_batch>(
+            std::move(data), std::move(message_offsets), batch_start, offset));
+        }
+        // Set along with the last batch, so that `has_next` is false once it is returned
+        if (offset >= end_offset or partition_end) { done = true; }
+      }
+      batch_ready.notify_all();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    done = true;
+  }
+  batch_ready.notify_all();
+}
+
+bool kafka_prefetching_reader::has_next() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return not batches.empty() or not done or error != nullptr;
+}
+
+std::unique_ptr<kafka_batch> kafka_prefetching_reader::next_batch()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  batch_ready.wait(lock, [&] { return not batches.empty() or done; });
+  if (batches.empty()) {
+    if (error != nullptr) { std::rethrow_exception(error); }
+    CUDF_FAIL("No Kafka batches left to read");
+  }
+
+  auto batch = std::move(batches.front());
+  batches.pop_front();
+  prefetched_bytes -= batch->size();
+  lock.unlock();
+  batch_taken.notify_all();
+  return batch;
+}
+
+kafka_prefetch_metrics kafka_prefetching_reader::metrics() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  auto const seconds =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - consumption_start).count();
+  return {std::max<int64_t>(high_watermark - next_offset, 0),
+          messages_consumed,
+          bytes_consumed,
+          seconds > 0 ? messages_consumed / seconds : 0.,
+          seconds > 0 ? bytes_consumed / seconds : 0.,
+          batches.size()};
+}
+
 }  // namespace kafka
 }  // namespace external
 }  // namespace io
@@ -16,9 +16,11 @@
 
 #include <cudf_kafka/kafka_consumer.hpp>
 #include <gtest/gtest.h>
+#include <librdkafka/rdkafka_mock.h>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
@@ -66,3 +68,144 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
       kafka_configs, python_callable, callback_wrapper, "csv-topic", 0, 0, 3, 5000, "\n"),
     cudf::logic_error);
 }
+
+/**
+ * @brief Fixture with a librdkafka mock cluster, whose topic partitions are filled with messages
+ * "0" to "9" in partition 0, "100" to "109" in partition 1, and so on.
+ */
+struct KafkaMockClusterTest : public ::testing::Test {
+  static constexpr int num_partitions = 3;
+
+  void SetUp() override
+  {
+    // The producer creates the mock cluster
+    std::string errstr;
+    auto producer_conf =
+      std::unique_ptr<RdKafka::Conf>(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+    ASSERT_EQ(RdKafka::Conf::CONF_OK, producer_conf->set("test.mock.num.brokers", "1", errstr));
+    producer.reset(RdKafka::Producer::create(producer_conf.get(), errstr));
+    ASSERT_NE(nullptr, producer);
+    auto mock_cluster = rd_kafka_handle_mock_cluster(producer->c_ptr());
+    ASSERT_EQ(RD_KAFKA_RESP_ERR_NO_ERROR,
+              rd_kafka_mock_topic_create(mock_cluster, "csv-topic", num_partitions, 1));
+    for (int partition = 0; partition < num_partitions; ++partition) {
+      for (int i = 0; i < 10; ++i) {
+        auto message = std::to_string(partition * 100 + i);
+        ASSERT_EQ(RdKafka::ERR_NO_ERROR,
+                  producer->produce("csv-topic",
+                                    partition,
+                                    RdKafka::Producer::RK_MSG_COPY,
+                                    message.data(),
+                                    message.size(),
+                                    nullptr,
+                                    0,
+                                    0,
+                                    nullptr));
+      }
+    }
+    ASSERT_EQ(RdKafka::ERR_NO_ERROR, producer->flush(10000));
+
+    kafka_configs["bootstrap.servers"] = rd_kafka_mock_cluster_bootstraps(mock_cluster);
+    kafka_configs["group.id"]          = "mock-cluster-test";
+  }
+
+  std::unique_ptr<RdKafka::Producer> producer;
+  std::map<std::string, std::string> kafka_configs;
+};
+
+TEST_F(KafkaMockClusterTest, PartitionedConsumer)
+{
+  kafka::kafka_partitioned_consumer source(
+    kafka_configs, nullptr, nullptr, "csv-topic", {{0, 0, 10}, {1, 2, 10}, {2, 0, 5}}, 10000, "\n");
+
+  std::string expected;
+  for (int i = 0; i < 10; ++i) {
+    expected += std::to_string(i) + "\n";
+  }
+  for (int i = 102; i < 110; ++i) {
+    expected += std::to_string(i) + "\n";
+  }
+  for (int i = 200; i < 205; ++i) {
+    expected += std::to_string(i) + "\n";
+  }
+
+  EXPECT_EQ((std::vector<int64_t>{10, 8, 5}), source.message_counts());
+  ASSERT_EQ(expected.size(), source.size());
+  auto const all_data = source.host_read(0, source.size());
+  EXPECT_EQ(expected,
+            std::string(reinterpret_cast<char const*>(all_data->data()), all_data->size()));
+
+  // Message 12 is the third message of the second partition range
+  auto const& offsets = source.message_offsets();
+  ASSERT_EQ(24u, offsets.size());
+  EXPECT_EQ(expected.size(), offsets.back());
+  auto const message = source.host_read(offsets[12], offsets[13] - offsets[12]);
+  EXPECT_EQ("104\n", std::string(reinterpret_cast<char const*>(message->data()), message->size()));
+}
+
+TEST_F(KafkaMockClusterTest, PartitionedConsumerError)
+{
+  // Offset 20 is past the end of the partition, and can't be reset
+  kafka_configs["auto.offset.reset"] = "error";
+  std::vector<kafka::kafka_partition_range> const partitions{{0, 0, 10}, {1, 20, 30}};
+  EXPECT_THROW(kafka::kafka_partitioned_consumer(
+                 kafka_configs, nullptr, nullptr, "csv-topic", partitions, 10000, "\n"),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaMockClusterTest, PrefetchingReader)
+{
+  kafka::kafka_prefetch_options options;
+  options.batch_messages = 4;
+  options.max_batches    = 1;
+  kafka::kafka_prefetching_reader reader(
+    kafka_configs, nullptr, nullptr, "csv-topic", 1, 1, 10, ",", options);
+
+  std::string data;
+  int64_t next_offset = 1;
+  while (reader.has_next()) {
+    auto const batch = reader.next_batch();
+    // At most four messages, followed by the size of the batch
+    ASSERT_LE(batch->message_offsets().size(), 5u);
+    EXPECT_EQ(batch->size(), batch->message_offsets().back());
+    EXPECT_EQ(next_offset, batch->start_offset());
+    next_offset = batch->end_offset();
+    auto const buffer = batch->host_read(0, batch->size());
+    data.append(reinterpret_cast<char const*>(buffer->data()), buffer->size());
+  }
+  EXPECT_EQ("101,102,103,104,105,106,107,108,109,", data);
+  EXPECT_EQ(10, next_offset);
+  EXPECT_THROW(reader.next_batch(), cudf::logic_error);
+
+  auto const metrics = reader.metrics();
+  EXPECT_EQ(9, metrics.messages_consumed);
+  EXPECT_EQ(data.size(), metrics.bytes_consumed);
+  EXPECT_EQ(0u, metrics.prefetched_batches);
+}
+
+TEST_F(KafkaMockClusterTest, PrefetchingReaderPartitionEnd)
+{
+  // The end offset is never reached; the end of the partition ends the consumption
+  kafka_configs["enable.partition.eof"] = "true";
+  kafka::kafka_prefetching_reader reader(
+    kafka_configs, nullptr, nullptr, "csv-topic", 2, 5, 100, ",", {});
+
+  std::string data;
+  while (reader.has_next()) {
+    auto const batch  = reader.next_batch();
+    auto const buffer = batch->host_read(0, batch->size());
+    data.append(reinterpret_cast<char const*>(buffer->data()), buffer->size());
+  }
+  EXPECT_EQ("205,206,207,208,209,", data);
+}
+
+TEST_F(KafkaMockClusterTest, PrefetchingReaderError)
+{
+  // Offset 20 is past the end of the partition, and can't be reset
+  kafka_configs["auto.offset.reset"] = "error";
+  kafka::kafka_prefetching_reader reader(
+    kafka_configs, nullptr, nullptr, "csv-topic", 0, 20, 30, ",", {});
+
+  EXPECT_TRUE(reader.has_next());
+  EXPECT_THROW(reader.next_batch(), cudf::logic_error);
+}
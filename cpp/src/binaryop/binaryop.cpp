@@ -47,6 +47,28 @@
 #include <thrust/optional.h>
 
 namespace cudf {
+namespace jit {
+kernel_instantiation binaryop_udf_kernel(std::string const& ptx,
+                                         data_type output_type,
+                                         data_type lhs_type,
+                                         data_type rhs_type)
+{
+  std::string const output_type_name = get_type_name(output_type);
+
+  std::string cuda_source = parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
+
+  std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
+                              .instantiate(output_type_name,  // list of template arguments
+                                           get_type_name(lhs_type),
+                                           get_type_name(rhs_type),
+                                           std::string("cudf::binops::jit::UserDefinedOp"));
+
+  return {&get_program_cache(*binaryop_jit_kernel_cu_jit),
+          std::move(kernel_name),
+          {{"binaryop/jit/operation-udf.hpp", std::move(cuda_source)}}};
+}
+}  // namespace jit
+
 namespace binops {
 
 /**
@@ -136,21 +158,7 @@ void binary_operation(mutable_column_view& out,
                       const std::string& ptx,
                       rmm::cuda_stream_view stream)
 {
-  std::string const output_type_name = cudf::jit::get_type_name(out.type());
-
-  std::string ptx_hash =
-    "prog_binop." + std::to_string(std::hash<std::string>{}(ptx + output_type_name));
-  std::string cuda_source =
-    cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
-
-  std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
-                              .instantiate(output_type_name,  // list of template arguments
-                                           cudf::jit::get_type_name(lhs.type()),
-                                           cudf::jit::get_type_name(rhs.type()),
-                                           std::string("cudf::binops::jit::UserDefinedOp"));
-
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  cudf::jit::get_kernel(cudf::jit::binaryop_udf_kernel(ptx, out.type(), lhs.type(), rhs.type()))
     ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
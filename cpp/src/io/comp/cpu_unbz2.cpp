@@ -82,8 +82,13 @@ For more information on these sources, see the manual.
 #include "io_uncomp.hpp"
 #include "unbz2.hpp"
 
+#include <io/utilities/thread_pool.hpp>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <future>
+#include <optional>
 #include <vector>
 
 namespace cudf {
@@ -597,5 +602,169 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+
+constexpr uint64_t bz2_block_magic = 0x314159265359ul;  // BCD of pi
+
+/**
+ * @brief Returns the bit offsets of all 48-bit block signatures in a range of the input.
+ *
+ * @param source Compressed stream
+ * @param sourceLen Size of the compressed stream
+ * @param begin First byte at which a signature can start
+ * @param end Byte after the last byte at which a signature can start
+ */
+std::vector<uint64_t> find_block_signatures(const uint8_t* source,
+                                            size_t sourceLen,
+                                            size_t begin,
+                                            size_t end)
+{
+  std::vector<uint64_t> bit_offsets;
+  if (begin >= end) { return bit_offsets; }
+
+  // Sliding window of the next 64 bits; a signature starting in the first byte of the window
+  // is fully contained in the window
+  uint64_t window = 0;
+  for (size_t i = begin; i < begin + 8; ++i) {
+    window = (window << 8) | ((i < sourceLen) ? source[i] : 0);
+  }
+  for (size_t pos = begin; pos < end; ++pos) {
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      if (((window << bit) >> 16) == bz2_block_magic) { bit_offsets.push_back(pos * 8 + bit); }
+    }
+    window = (window << 8) | ((pos + 8 < sourceLen) ? source[pos + 8] : 0);
+  }
+  return bit_offsets;
+}
+
+/**
+ * @brief Decodes a single block of a bzip2 stream.
+ *
+ * @param[in] source Compressed stream
+ * @param[in] sourceLen Size of the compressed stream
+ * @param[in] blockSize100k Block size of the stream, from the file header
+ * @param[in] bit_offset Bit offset of the block signature
+ * @param[out] next_bit_offset Bit offset of the signature that follows the block
+ * @param[out] is_last Whether the block is followed by the end-of-stream signature
+ *
+ * @return Decompressed block; `std::nullopt` if the block is not valid
+ */
+std::optional<std::vector<uint8_t>> decompress_single_block(const uint8_t* source,
+                                                            size_t sourceLen,
+                                                            uint32_t blockSize100k,
+                                                            uint64_t bit_offset,
+                                                            uint64_t* next_bit_offset,
+                                                            bool* is_last)
+{
+  unbz_state_s s{};
+  s.base = source;
+  s.end  = source + sourceLen - 4;  // The final combined CRC is not read
+  s.cur  = source + (bit_offset >> 3);
+  if (s.cur + 8 > s.end) { return std::nullopt; }
+  s.bitbuf        = __builtin_bswap64(*reinterpret_cast<const uint64_t*>(s.cur));
+  s.bitpos        = static_cast<uint32_t>(bit_offset & 7);
+  s.blockSize100k = blockSize100k;
+  s.tt.resize(blockSize100k * 100000);
+
+  auto const ret = bz2_decompress_block(&s);
+  if (ret != BZ_OK && ret != BZ_STREAM_END) { return std::nullopt; }
+  *next_bit_offset = ((s.cur - s.base) << 3) + s.bitpos;
+  *is_last         = (ret == BZ_STREAM_END);
+
+  // The size of the output is only known after undoing the run-length encoding, which is repeated
+  // if the initial estimate is too small
+  std::vector<uint8_t> out(static_cast<size_t>(s.save_nblock) * 2);
+  for (int pass = 0; pass < 2; ++pass) {
+    s.out     = out.data();
+    s.outbase = out.data();
+    s.outend  = out.data() + out.size();
+    bzUnRLE(&s);
+    if (s.nblock_used != s.save_nblock + 1) { return std::nullopt; }
+    auto const out_size = static_cast<size_t>(s.out - s.outbase);
+    if (out_size <= out.size()) {
+      out.resize(out_size);
+      return out;
+    }
+    out.resize(out_size);
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+std::optional<std::vector<uint8_t>> cpu_bz2_uncompress_parallel(const uint8_t* source,
+                                                                size_t sourceLen)
+{
+  constexpr size_t header_size = 4;
+  if (source == nullptr || sourceLen < header_size + 12) { return std::nullopt; }
+  if (source[0] != 'B' || source[1] != 'Z' || source[2] != 'h') { return std::nullopt; }
+  uint32_t const blockSize100k = source[3] - '0';
+  if (blockSize100k < 1 || blockSize100k > 9) { return std::nullopt; }
+
+  // Locate the candidate blocks, scanning segments of the input in parallel
+  auto& pool                   = detail::host_decompression_pool();
+  constexpr size_t min_segment = 1 << 20;
+  auto const scan_size         = sourceLen - header_size;
+  auto const num_segments      = std::clamp<size_t>(
+    scan_size / min_segment, 1, static_cast<size_t>(pool.get_thread_count()));
+  auto const segment_size = (scan_size + num_segments - 1) / num_segments;
+  std::vector<std::future<std::vector<uint64_t>>> scan_tasks;
+  for (size_t begin = header_size; begin < sourceLen; begin += segment_size) {
+    scan_tasks.emplace_back(pool.submit(find_block_signatures,
+                                        source,
+                                        sourceLen,
+                                        begin,
+                                        std::min(begin + segment_size, sourceLen)));
+  }
+  std::vector<uint64_t> block_offsets;
+  for (auto& task : scan_tasks) {
+    auto const offsets = task.get();
+    block_offsets.insert(block_offsets.end(), offsets.begin(), offsets.end());
+  }
+  if (block_offsets.size() < 2 || block_offsets.front() != header_size * 8) {
+    return std::nullopt;
+  }
+
+  // Decode the candidate blocks in parallel
+  struct decoded_block {
+    std::optional<std::vector<uint8_t>> data;
+    uint64_t next_bit_offset = 0;
+    bool is_last             = false;
+  };
+  auto decode = [source, sourceLen, blockSize100k](uint64_t bit_offset) {
+    decoded_block block;
+    block.data = decompress_single_block(
+      source, sourceLen, blockSize100k, bit_offset, &block.next_bit_offset, &block.is_last);
+    return block;
+  };
+  std::vector<std::future<decoded_block>> decode_tasks;
+  decode_tasks.reserve(block_offsets.size());
+  for (auto const bit_offset : block_offsets) {
+    decode_tasks.emplace_back(pool.submit(decode, bit_offset));
+  }
+  std::vector<decoded_block> blocks;
+  blocks.reserve(decode_tasks.size());
+  for (auto& task : decode_tasks) {
+    blocks.emplace_back(task.get());
+  }
+
+  // Keep the chain of blocks from the first block; a false signature is either not a valid block
+  // or is skipped by the chain
+  std::vector<uint8_t> out;
+  uint64_t bit_offset = block_offsets.front();
+  size_t idx          = 0;
+  while (true) {
+    idx = std::lower_bound(block_offsets.begin() + idx, block_offsets.end(), bit_offset) -
+          block_offsets.begin();
+    if (idx == block_offsets.size() || block_offsets[idx] != bit_offset) { return std::nullopt; }
+    auto const& block = blocks[idx];
+    if (not block.data.has_value()) { return std::nullopt; }
+    out.insert(out.end(), block.data->begin(), block.data->end());
+    if (block.is_last) { break; }
+    bit_offset = block.next_bit_offset;
+  }
+  return out;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -21,16 +21,36 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 using cudf::host_span;
 
 namespace cudf {
+namespace detail {
+class thread_pool;
+}  // namespace detail
+
 namespace io {
+namespace detail {
+
+/**
+ * @brief Returns the process-wide thread pool used for host decompression.
+ *
+ * Its size can be set with the `LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT` environment variable,
+ * and defaults to the number of hardware threads. Tasks of this pool must not wait for other tasks
+ * of the pool.
+ */
+cudf::detail::thread_pool& host_decompression_pool();
+
+}  // namespace detail
 
 /**
  * @brief Decompresses a system memory buffer.
  *
+ * Concatenated gzip members, and all file entries of a ZIP archive, are decompressed as a single
+ * stream.
+ *
  * @param compression Type of compression of the input data
  * @param src Compressed host buffer
  *
@@ -43,6 +63,153 @@ size_t decompress(compression_type compression,
                   host_span<uint8_t> dst,
                   rmm::cuda_stream_view stream);
 
+/**
+ * @brief Decompresses a batch of independent system memory blocks.
+ *
+ * The blocks are distributed over a process-wide thread pool, whose size can be set with the
+ * `LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT` environment variable; each thread reuses its
+ * decompressor state across blocks. ZSTD blocks are decompressed with a single nvcomp call.
+ *
+ * @param compression Type of compression of the blocks
+ * @param srcs Compressed host blocks
+ * @param dsts Host buffers for the decompressed blocks, one per compressed block
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Number of bytes written to each output buffer
+ */
+std::vector<size_t> decompress(compression_type compression,
+                               host_span<host_span<uint8_t const> const> srcs,
+                               host_span<host_span<uint8_t> const> dsts,
+                               rmm::cuda_stream_view stream);
+
+/**
+ * @brief Seek index of a gzip file.
+ *
+ * Each checkpoint holds the inflate state at a DEFLATE block boundary, following zlib's zran
+ * example, so that decompression can start at the checkpoint instead of at the beginning of the
+ * file. Each member of the file starts with a checkpoint without a window.
+ */
+struct gzip_index {
+  struct checkpoint {
+    size_t in_offset;             ///< Offset of the first compressed byte after the checkpoint
+    uint8_t bits;                 ///< Bits of the previous byte that follow the checkpoint
+    size_t out_offset;            ///< Uncompressed offset of the checkpoint
+    std::vector<uint8_t> window;  ///< Up to 32KB of uncompressed data preceding the checkpoint
+  };
+
+  size_t compressed_size   = 0;
+  size_t uncompressed_size = 0;
+  std::vector<checkpoint> checkpoints;  ///< Sorted by offset
+
+  /**
+   * @brief Returns the host memory size of the index, in bytes.
+   */
+  [[nodiscard]] size_t size_bytes() const;
+};
+
+/**
+ * @brief Decompresses a gzip file and builds its seek index.
+ *
+ * @param src Compressed gzip file
+ * @param spacing Minimum number of uncompressed bytes between two checkpoints of a member
+ * @param[out] dst Decompressed data
+ *
+ * @return Seek index of the file
+ */
+gzip_index build_gzip_index(host_span<uint8_t const> src,
+                            size_t spacing,
+                            std::vector<uint8_t>& dst);
+
+/**
+ * @brief Returns the range of compressed bytes required to decompress an uncompressed range.
+ *
+ * @param index Seek index of the gzip file
+ * @param offset Uncompressed offset of the range
+ * @param size Uncompressed size of the range
+ *
+ * @return Begin and end offsets of the compressed bytes
+ */
+std::pair<size_t, size_t> gzip_index_input_range(gzip_index const& index,
+                                                 size_t offset,
+                                                 size_t size);
+
+/**
+ * @brief Decompresses a range of a gzip file, starting from the closest preceding checkpoint.
+ *
+ * @param src Compressed bytes of the file, including at least the range returned by
+ * `gzip_index_input_range`
+ * @param src_offset Offset of `src` in the compressed file
+ * @param index Seek index of the file
+ * @param offset Uncompressed offset of the range
+ * @param size Uncompressed size of the range; truncated at the end of the file
+ *
+ * @return Decompressed range
+ */
+std::vector<uint8_t> decompress_gzip_range(host_span<uint8_t const> src,
+                                           size_t src_offset,
+                                           gzip_index const& index,
+                                           size_t offset,
+                                           size_t size);
+
+/**
+ * @brief Decompresses the start of a gzip file, up to the given uncompressed size.
+ *
+ * Members are inflated in order, and decompression stops once `size` bytes are produced, so the
+ * cost is proportional to `size` rather than to the size of the file. The trailers of the members
+ * are not verified.
+ *
+ * @param src Compressed gzip file
+ * @param size Number of uncompressed bytes to decompress; truncated at the end of the file
+ *
+ * @return Decompressed data
+ */
+std::vector<uint8_t> decompress_gzip_prefix(host_span<uint8_t const> src, size_t size);
+
+/**
+ * @brief Serializes a gzip seek index, e.g. to store it next to the compressed file.
+ */
+std::vector<uint8_t> serialize_gzip_index(gzip_index const& index);
+
+/**
+ * @brief Deserializes a gzip seek index written by `serialize_gzip_index`.
+ */
+gzip_index deserialize_gzip_index(host_span<uint8_t const> src);
+
+/**
+ * @brief Entry of a ZIP archive, as described by its central directory.
+ */
+struct zip_entry {
+  std::string name;      ///< File name of the entry; directory names end with '/'
+  uint16_t comp_method;  ///< Compression method; 0 for stored entries, 8 for DEFLATE
+  uint32_t crc32;        ///< CRC32 of the uncompressed data
+  size_t data_offset;    ///< Offset of the compressed data in the archive
+  size_t comp_size;      ///< Compressed size
+  size_t uncomp_size;    ///< Uncompressed size
+};
+
+/**
+ * @brief Returns the entries of a ZIP archive, in the order of its central directory.
+ *
+ * Entries with invalid local headers are skipped. ZIP64 sizes and offsets of the entries are
+ * supported.
+ *
+ * @param src ZIP archive
+ *
+ * @return Entries of the archive; empty if the data is not a ZIP archive
+ */
+std::vector<zip_entry> list_zip_entries(host_span<uint8_t const> src);
+
+/**
+ * @brief Decompresses entries of a ZIP archive concurrently, on the host decompression pool.
+ *
+ * @param src ZIP archive
+ * @param entries Entries to decompress, as returned by `list_zip_entries`
+ *
+ * @return Uncompressed data of each entry
+ */
+std::vector<std::vector<uint8_t>> decompress_zip_entries(host_span<uint8_t const> src,
+                                                         host_span<zip_entry const> entries);
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
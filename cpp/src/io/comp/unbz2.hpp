@@ -77,6 +77,11 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +107,21 @@ int32_t cpu_bz2_uncompress(const uint8_t* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+/**
+ * @brief Decompresses a bzip2 stream, decoding its blocks in parallel.
+ *
+ * The blocks are located by scanning the input for their 48-bit signature, decoded independently
+ * on the host decompression thread pool, and their outputs are concatenated in order.
+ *
+ * @param input Compressed bzip2 stream, including the file header
+ * @param inlen Size of the compressed stream
+ *
+ * @return Decompressed data; `std::nullopt` if the stream has a single block, or if the located
+ * signatures do not delimit valid blocks (the signature can occur by chance in compressed data),
+ * in which case the stream should be decoded with `cpu_bz2_uncompress`
+ */
+std::optional<std::vector<uint8_t>> cpu_bz2_uncompress_parallel(const uint8_t* input,
+                                                                size_t inlen);
+
 }  // namespace io
 }  // namespace cudf
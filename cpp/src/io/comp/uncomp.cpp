@@ -21,11 +21,18 @@
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <io/utilities/config_utils.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cuda_runtime.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>  // memset
+#include <future>
+#include <numeric>
+#include <optional>
 
 #include <zlib.h>  // uncompress
 
@@ -127,7 +134,10 @@ struct zip_archive_s {
   const zip_cdfh_s* cdfh;    // start of central directory file headers
 };
 
-bool ParseGZArchive(gz_archive_s* dst, const uint8_t* raw, size_t len)
+/**
+ * @brief Parses the header of a gzip member; `comp_data` is set to the data after the header.
+ */
+bool ParseGZHeader(gz_archive_s* dst, const uint8_t* raw, size_t len)
 {
   const gz_file_header_s* fhdr;
 
@@ -182,13 +192,23 @@ bool ParseGZArchive(gz_archive_s* dst, const uint8_t* raw, size_t len)
     raw += 2;
     len -= 2;
   }
+  dst->comp_data = raw;
+  dst->comp_len  = len;
+  return fhdr->comp_mthd == 8;
+}
+
+bool ParseGZArchive(gz_archive_s* dst, const uint8_t* raw, size_t len)
+{
+  if (!ParseGZHeader(dst, raw, len)) return false;
+  raw = dst->comp_data;
+  len = dst->comp_len;
   if (len < 8) return false;
   dst->crc32 = raw[len - 8] | (raw[len - 7] << 8) | (raw[len - 6] << 16) | (raw[len - 5] << 24);
   dst->isize = raw[len - 4] | (raw[len - 3] << 8) | (raw[len - 2] << 16) | (raw[len - 1] << 24);
   len -= 8;
   dst->comp_data = raw;
   dst->comp_len  = len;
-  return (fhdr->comp_mthd == 8 && len > 0);
+  return len > 0;
 }
 
 bool OpenZipArchive(zip_archive_s* dst, const uint8_t* raw, size_t len)
@@ -219,62 +239,436 @@ bool OpenZipArchive(zip_archive_s* dst, const uint8_t* raw, size_t len)
   return (dst->eocd && dst->cdfh);
 }
 
-int cpu_inflate(uint8_t* uncomp_data, size_t* destLen, const uint8_t* comp_data, size_t comp_len)
-{
-  int zerr;
-  z_stream strm;
-
-  memset(&strm, 0, sizeof(strm));
-  strm.next_in   = const_cast<Bytef*>(reinterpret_cast<Bytef const*>(comp_data));
-  strm.avail_in  = comp_len;
-  strm.total_in  = 0;
-  strm.next_out  = uncomp_data;
-  strm.avail_out = *destLen;
-  strm.total_out = 0;
-  zerr           = inflateInit2(&strm, -15);  // -15 for raw data without GZIP headers
-  if (zerr != 0) {
-    *destLen = 0;
-    return zerr;
-  }
-  zerr     = inflate(&strm, Z_FINISH);
-  *destLen = strm.total_out;
-  inflateEnd(&strm);
-  return (zerr == Z_STREAM_END) ? Z_OK : zerr;
+namespace {
+
+constexpr size_t gzip_window_size = 32768;
+// zlib buffer lengths are 32-bit, so larger buffers are processed in chunks
+constexpr size_t max_zlib_chunk_size = 1u << 30;
+
+uint32_t read_le32(uint8_t const* raw)
+{
+  return raw[0] | (raw[1] << 8) | (raw[2] << 16) | (static_cast<uint32_t>(raw[3]) << 24);
+}
+
+/**
+ * @brief Computes the CRC32 of a buffer of any size.
+ */
+uint32_t compute_crc32(host_span<uint8_t const> data)
+{
+  uLong crc = crc32(0, nullptr, 0);
+  for (size_t pos = 0; pos < data.size(); pos += max_zlib_chunk_size) {
+    crc = crc32(crc, data.data() + pos, std::min(data.size() - pos, max_zlib_chunk_size));
+  }
+  return crc;
+}
+
+/**
+ * @brief Calls `func` for each index in `[0, count)` on the host decompression pool.
+ *
+ * Indices are handed out one at a time, so that items of very different sizes are balanced over
+ * the threads.
+ */
+template <typename Func>
+void for_each_index_in_pool(size_t count, Func func)
+{
+  if (count == 1) {
+    func(0);
+    return;
+  }
+  std::atomic<size_t> next_index{0};
+  auto process_indices = [&]() {
+    for (auto i = next_index++; i < count; i = next_index++) {
+      func(i);
+    }
+  };
+  auto& pool = detail::host_decompression_pool();
+  std::vector<std::future<void>> tasks;
+  for (size_t t = 0; t < std::min<size_t>(count, pool.get_thread_count()); ++t) {
+    tasks.emplace_back(pool.submit(process_indices));
+  }
+  // Wait for all tasks before rethrowing any error, as the tasks reference the local state
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+}
+
+/**
+ * @brief Returns whether a valid gzip member header starts at the given offset.
+ */
+bool is_gzip_member_start(host_span<uint8_t const> src, size_t offset, gz_archive_s* gz)
+{
+  return offset < src.size() && ParseGZHeader(gz, src.data() + offset, src.size() - offset) &&
+         (gz->fhdr->flags & 0xe0) == 0;  // reserved flags must be zero
 }
 
+struct gzip_member {
+  std::vector<uint8_t> data;
+  size_t end;  // offset of the first byte after the member trailer
+  std::vector<gzip_index::checkpoint> checkpoints;  // uncompressed offsets relative to the member
+};
+
 /**
- * @brief Uncompresses a raw DEFLATE stream to a char vector.
- * The vector will be grown to match the uncompressed size
- * Optimized for the case where the initial size is the uncompressed
- * size truncated to 32-bit, and grows the buffer in 1GB increments.
+ * @brief Inflates the gzip member that starts at the given offset and verifies its trailer.
  *
- * @param[out] dst Destination vector
- * @param[in] comp_data Raw compressed data
- * @param[in] comp_len Compressed data size
+ * @param src Compressed gzip file
+ * @param offset Offset of the member header
+ * @param spacing Minimum distance between two index checkpoints; zero to only record the start
+ * @param size_hint Expected uncompressed size; zero if unknown
+ *
+ * @return Decompressed member; empty if the data at the offset is not a valid member
  */
-void cpu_inflate_vector(std::vector<uint8_t>& dst, const uint8_t* comp_data, size_t comp_len)
+std::optional<gzip_member> inflate_gzip_member(host_span<uint8_t const> src,
+                                               size_t offset,
+                                               size_t spacing,
+                                               size_t size_hint)
 {
+  gz_archive_s gz;
+  if (!is_gzip_member_start(src, offset, &gz)) { return std::nullopt; }
+  size_t in_pos = gz.comp_data - src.data();
+
   z_stream strm{};
-  strm.next_in   = const_cast<Bytef*>(reinterpret_cast<Bytef const*>(comp_data));
-  strm.avail_in  = comp_len;
-  strm.total_in  = 0;
-  strm.next_out  = dst.data();
-  strm.avail_out = dst.size();
-  strm.total_out = 0;
-  auto zerr      = inflateInit2(&strm, -15);  // -15 for raw data without GZIP headers
-  CUDF_EXPECTS(zerr == 0, "Error in DEFLATE stream");
+  if (inflateInit2(&strm, -15) != Z_OK) { return std::nullopt; }
+  std::unique_ptr<z_stream, decltype(&inflateEnd)> const strm_guard(&strm, &inflateEnd);
+
+  gzip_member member;
+  member.checkpoints.push_back({in_pos, 0, 0, {}});
+  // Assume ~4:1 compression if the size is not known in advance, and grow as needed
+  member.data.resize(size_hint != 0 ? size_hint
+                                    : std::min<size_t>((src.size() - in_pos) * 4 + 4096, 1 << 20));
+  size_t out_pos = 0;
+  int zerr       = Z_OK;
   do {
-    if (strm.avail_out == 0) {
-      dst.resize(strm.total_out + (1 << 30));
-      strm.avail_out = dst.size() - strm.total_out;
-      strm.next_out  = reinterpret_cast<uint8_t*>(dst.data()) + strm.total_out;
+    if (strm.avail_in == 0) {
+      strm.next_in  = const_cast<Bytef*>(src.data() + in_pos);
+      strm.avail_in = std::min(src.size() - in_pos, max_zlib_chunk_size);
+      in_pos += strm.avail_in;
+    }
+    if (out_pos == member.data.size()) { member.data.resize(member.data.size() * 2); }
+    strm.next_out        = member.data.data() + out_pos;
+    strm.avail_out       = std::min(member.data.size() - out_pos, max_zlib_chunk_size);
+    auto const avail_out = strm.avail_out;
+    zerr                 = inflate(&strm, (spacing != 0) ? Z_BLOCK : Z_NO_FLUSH);
+    out_pos += avail_out - strm.avail_out;
+    // Record a checkpoint at the end of each block, other than the last one, past the spacing
+    if (zerr == Z_OK && spacing != 0 && (strm.data_type & 128) && !(strm.data_type & 64) &&
+        out_pos - member.checkpoints.back().out_offset >= spacing) {
+      auto const window_begin = member.data.begin() + out_pos - std::min(out_pos, gzip_window_size);
+      member.checkpoints.push_back({in_pos - strm.avail_in,
+                                    static_cast<uint8_t>(strm.data_type & 7),
+                                    out_pos,
+                                    {window_begin, member.data.begin() + out_pos}});
+    }
+  } while (zerr == Z_OK);
+  auto const trailer = in_pos - strm.avail_in;
+  if (zerr != Z_STREAM_END || src.size() - trailer < 8) { return std::nullopt; }
+
+  if (compute_crc32({member.data.data(), out_pos}) != read_le32(src.data() + trailer) ||
+      read_le32(src.data() + trailer + 4) != static_cast<uint32_t>(out_pos)) {
+    return std::nullopt;
+  }
+  // Release the unused part of the initial guess, which is held until the members are chained
+  member.data.resize(out_pos);
+  member.data.shrink_to_fit();
+  member.end = trailer + 8;
+  return member;
+}
+
+/**
+ * @brief Decompresses all members of a gzip file.
+ *
+ * Member boundaries are not known before the preceding member is inflated, so all valid member
+ * headers are inflated in parallel as candidates; the members are then chained from the start of
+ * the file and the candidates that turn out to be inside a member are discarded. Trailing bytes
+ * that do not start a member are ignored.
+ *
+ * @param src Compressed gzip file
+ * @param spacing Minimum distance between two index checkpoints; zero to not build the index
+ * @param[out] index Seek index of the file; can be null if `spacing` is zero
+ *
+ * @return Decompressed data
+ */
+std::vector<uint8_t> decompress_gzip_members(host_span<uint8_t const> src,
+                                             size_t spacing,
+                                             gzip_index* index)
+{
+  std::vector<size_t> candidates;
+  auto const src_end = src.data() + src.size();
+  for (auto ptr = src.data();
+       (ptr = static_cast<uint8_t const*>(std::memchr(ptr, 0x1f, src_end - ptr))) != nullptr;
+       ++ptr) {
+    gz_archive_s gz;
+    if (is_gzip_member_start(src, ptr - src.data(), &gz)) {
+      candidates.push_back(ptr - src.data());
+    }
+  }
+  CUDF_EXPECTS(not candidates.empty() and candidates.front() == 0, "Invalid GZIP header");
+
+  std::vector<std::optional<gzip_member>> members(candidates.size());
+  if (candidates.size() == 1) {
+    // The trailer of a single member holds its size modulo 2^32
+    members[0] = inflate_gzip_member(src, 0, spacing, read_le32(src_end - 4));
+  } else {
+    for_each_index_in_pool(candidates.size(), [&](size_t i) {
+      members[i] = inflate_gzip_member(src, candidates[i], spacing, 0);
+    });
+  }
+
+  std::vector<gzip_member*> chain;
+  size_t uncomp_size = 0;
+  for (size_t pos = 0;;) {
+    auto const it = std::lower_bound(candidates.cbegin(), candidates.cend(), pos);
+    if (it == candidates.cend() or *it != pos) { break; }
+    auto& member = members[it - candidates.cbegin()];
+    CUDF_EXPECTS(member.has_value(), "Error in GZIP stream");
+    chain.push_back(&member.value());
+    uncomp_size += member->data.size();
+    pos = member->end;
+  }
+
+  if (index != nullptr) {
+    index->compressed_size   = src.size();
+    index->uncompressed_size = uncomp_size;
+    index->checkpoints.clear();
+    size_t out_offset = 0;
+    for (auto member : chain) {
+      for (auto& checkpoint : member->checkpoints) {
+        checkpoint.out_offset += out_offset;
+        index->checkpoints.push_back(std::move(checkpoint));
+      }
+      out_offset += member->data.size();
+    }
+  }
+
+  if (chain.size() == 1) { return std::move(chain.front()->data); }
+  std::vector<uint8_t> dst(uncomp_size);
+  auto dst_ptr = dst.data();
+  for (auto member : chain) {
+    dst_ptr = std::copy(member->data.cbegin(), member->data.cend(), dst_ptr);
+  }
+  return dst;
+}
+
+/**
+ * @brief Returns the last checkpoint at or before the given uncompressed offset.
+ */
+gzip_index::checkpoint const& find_checkpoint(gzip_index const& index, size_t offset)
+{
+  CUDF_EXPECTS(not index.checkpoints.empty(), "Empty GZIP index");
+  auto const it = std::upper_bound(
+    index.checkpoints.cbegin(), index.checkpoints.cend(), offset, [](size_t ofs, auto const& cp) {
+      return ofs < cp.out_offset;
+    });
+  return *(it - 1);
+}
+
+}  // namespace
+
+size_t gzip_index::size_bytes() const
+{
+  return std::accumulate(checkpoints.cbegin(),
+                         checkpoints.cend(),
+                         sizeof(gzip_index),
+                         [](size_t sum, auto const& cp) {
+                           return sum + sizeof(checkpoint) + cp.window.size();
+                         });
+}
+
+gzip_index build_gzip_index(host_span<uint8_t const> src,
+                            size_t spacing,
+                            std::vector<uint8_t>& dst)
+{
+  CUDF_EXPECTS(spacing > 0, "GZIP index spacing must be positive");
+  gzip_index index;
+  dst = decompress_gzip_members(src, spacing, &index);
+  return index;
+}
+
+std::pair<size_t, size_t> gzip_index_input_range(gzip_index const& index,
+                                                 size_t offset,
+                                                 size_t size)
+{
+  CUDF_EXPECTS(offset <= index.uncompressed_size, "Offset is past the end of the GZIP data");
+  auto const end_offset = offset + std::min(size, index.uncompressed_size - offset);
+
+  auto const& first = find_checkpoint(index, offset);
+  // The data up to a checkpoint only depends on the bytes before its input offset
+  auto const last =
+    std::lower_bound(index.checkpoints.cbegin(),
+                     index.checkpoints.cend(),
+                     end_offset,
+                     [](auto const& cp, size_t ofs) { return cp.out_offset < ofs; });
+  return {first.in_offset - (first.bits != 0 ? 1 : 0),
+          (last == index.checkpoints.cend()) ? index.compressed_size : last->in_offset};
+}
+
+std::vector<uint8_t> decompress_gzip_range(host_span<uint8_t const> src,
+                                           size_t src_offset,
+                                           gzip_index const& index,
+                                           size_t offset,
+                                           size_t size)
+{
+  auto const [in_begin, in_end] = gzip_index_input_range(index, offset, size);
+  CUDF_EXPECTS(src_offset <= in_begin and in_end <= src_offset + src.size(),
+               "GZIP input does not cover the requested range");
+  size = std::min(size, index.uncompressed_size - offset);
+  std::vector<uint8_t> dst(size);
+  if (size == 0) { return dst; }
+
+  z_stream strm{};
+  CUDF_EXPECTS(inflateInit2(&strm, -15) == Z_OK, "Cannot initialize DEFLATE decompressor");
+  std::unique_ptr<z_stream, decltype(&inflateEnd)> const strm_guard(&strm, &inflateEnd);
+
+  // Restore the inflate state at the checkpoint
+  auto const& checkpoint = find_checkpoint(index, offset);
+  size_t in_pos          = checkpoint.in_offset - src_offset;
+  if (checkpoint.bits != 0) {
+    CUDF_EXPECTS(
+      inflatePrime(&strm, checkpoint.bits, src[in_pos - 1] >> (8 - checkpoint.bits)) == Z_OK,
+      "Error in GZIP index");
+  }
+  if (not checkpoint.window.empty()) {
+    CUDF_EXPECTS(
+      inflateSetDictionary(&strm, checkpoint.window.data(), checkpoint.window.size()) == Z_OK,
+      "Error in GZIP index");
+  }
+
+  // Data between the checkpoint and the range is decompressed into a scratch buffer
+  std::vector<uint8_t> skipped(std::min(offset - checkpoint.out_offset, gzip_window_size));
+  auto out_pos = checkpoint.out_offset;
+  while (out_pos < offset + size) {
+    if (strm.avail_in == 0) {
+      strm.next_in  = const_cast<Bytef*>(src.data() + in_pos);
+      strm.avail_in = std::min(src.size() - in_pos, max_zlib_chunk_size);
+      in_pos += strm.avail_in;
+    }
+    if (out_pos < offset) {
+      strm.next_out  = skipped.data();
+      strm.avail_out = std::min(offset - out_pos, skipped.size());
+    } else {
+      strm.next_out  = dst.data() + (out_pos - offset);
+      strm.avail_out = std::min(offset + size - out_pos, max_zlib_chunk_size);
+    }
+    auto const avail_out = strm.avail_out;
+    auto const zerr      = inflate(&strm, Z_NO_FLUSH);
+    out_pos += avail_out - strm.avail_out;
+    if (out_pos == offset + size) { break; }
+    if (zerr == Z_STREAM_END) {
+      // Continue with the next member
+      gz_archive_s gz;
+      CUDF_EXPECTS(is_gzip_member_start(src, in_pos - strm.avail_in + 8, &gz),
+                   "Error in GZIP stream");
+      in_pos        = gz.comp_data - src.data();
+      strm.avail_in = 0;
+      CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Cannot reset DEFLATE decompressor");
+    } else {
+      CUDF_EXPECTS(zerr == Z_OK, "Error in GZIP stream");
+    }
+  }
+  return dst;
+}
+
+std::vector<uint8_t> decompress_gzip_prefix(host_span<uint8_t const> src, size_t size)
+{
+  gz_archive_s gz;
+  CUDF_EXPECTS(is_gzip_member_start(src, 0, &gz), "Invalid GZIP header");
+
+  z_stream strm{};
+  CUDF_EXPECTS(inflateInit2(&strm, -15) == Z_OK, "Cannot initialize DEFLATE decompressor");
+  std::unique_ptr<z_stream, decltype(&inflateEnd)> const strm_guard(&strm, &inflateEnd);
+
+  // Assume ~4:1 compression, and grow as needed up to the requested size
+  std::vector<uint8_t> dst(std::min({size, src.size() * 4 + 4096, size_t{1} << 20}));
+  size_t in_pos  = gz.comp_data - src.data();
+  size_t out_pos = 0;
+  while (out_pos < size) {
+    if (strm.avail_in == 0) {
+      strm.next_in  = const_cast<Bytef*>(src.data() + in_pos);
+      strm.avail_in = std::min(src.size() - in_pos, max_zlib_chunk_size);
+      in_pos += strm.avail_in;
+    }
+    if (out_pos == dst.size()) { dst.resize(std::min(dst.size() * 2, size)); }
+    strm.next_out        = dst.data() + out_pos;
+    strm.avail_out       = std::min(dst.size() - out_pos, max_zlib_chunk_size);
+    auto const avail_out = strm.avail_out;
+    auto const zerr      = inflate(&strm, Z_NO_FLUSH);
+    out_pos += avail_out - strm.avail_out;
+    if (zerr == Z_STREAM_END) {
+      // Continue with the next member; trailing bytes that do not start a member are ignored
+      if (not is_gzip_member_start(src, in_pos - strm.avail_in + 8, &gz)) { break; }
+      in_pos        = gz.comp_data - src.data();
+      strm.avail_in = 0;
+      CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Cannot reset DEFLATE decompressor");
+    } else {
+      CUDF_EXPECTS(zerr == Z_OK, "Error in GZIP stream");
     }
-    zerr = inflate(&strm, Z_SYNC_FLUSH);
-  } while ((zerr == Z_BUF_ERROR || zerr == Z_OK) && strm.avail_out == 0 &&
-           strm.total_out == dst.size());
-  dst.resize(strm.total_out);
-  inflateEnd(&strm);
-  CUDF_EXPECTS(zerr == Z_STREAM_END, "Error in DEFLATE stream");
+  }
+  dst.resize(out_pos);
+  return dst;
+}
+
+namespace {
+
+template <typename T>
+void write_index_field(std::vector<uint8_t>& dst, T value)
+{
+  auto const raw = reinterpret_cast<uint8_t const*>(&value);
+  dst.insert(dst.end(), raw, raw + sizeof(T));
+}
+
+template <typename T>
+T read_index_field(host_span<uint8_t const> src, size_t& pos)
+{
+  CUDF_EXPECTS(pos + sizeof(T) <= src.size(), "Truncated GZIP index");
+  T value;
+  std::memcpy(&value, src.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return value;
+}
+
+constexpr uint32_t gzip_index_magic = 0x5849'5a47;  // "GZIX"
+
+}  // namespace
+
+std::vector<uint8_t> serialize_gzip_index(gzip_index const& index)
+{
+  std::vector<uint8_t> dst;
+  dst.reserve(index.size_bytes());
+  write_index_field<uint32_t>(dst, gzip_index_magic);
+  write_index_field<uint64_t>(dst, index.compressed_size);
+  write_index_field<uint64_t>(dst, index.uncompressed_size);
+  write_index_field<uint64_t>(dst, index.checkpoints.size());
+  for (auto const& cp : index.checkpoints) {
+    write_index_field<uint64_t>(dst, cp.in_offset);
+    write_index_field<uint8_t>(dst, cp.bits);
+    write_index_field<uint64_t>(dst, cp.out_offset);
+    write_index_field<uint32_t>(dst, cp.window.size());
+    dst.insert(dst.end(), cp.window.cbegin(), cp.window.cend());
+  }
+  return dst;
+}
+
+gzip_index deserialize_gzip_index(host_span<uint8_t const> src)
+{
+  size_t pos = 0;
+  CUDF_EXPECTS(read_index_field<uint32_t>(src, pos) == gzip_index_magic, "Invalid GZIP index");
+  gzip_index index;
+  index.compressed_size   = read_index_field<uint64_t>(src, pos);
+  index.uncompressed_size = read_index_field<uint64_t>(src, pos);
+  index.checkpoints.resize(read_index_field<uint64_t>(src, pos));
+  for (auto& cp : index.checkpoints) {
+    cp.in_offset         = read_index_field<uint64_t>(src, pos);
+    cp.bits              = read_index_field<uint8_t>(src, pos);
+    cp.out_offset        = read_index_field<uint64_t>(src, pos);
+    auto const window_sz = read_index_field<uint32_t>(src, pos);
+    CUDF_EXPECTS(window_sz <= gzip_window_size and pos + window_sz <= src.size(),
+                 "Invalid GZIP index");
+    cp.window.assign(src.data() + pos, src.data() + pos + window_sz);
+    pos += window_sz;
+  }
+  return index;
 }
 
 std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t const> src)
@@ -291,49 +685,33 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
     case compression_type::AUTO:
     case compression_type::GZIP: {
       gz_archive_s gz;
-      if (ParseGZArchive(&gz, raw, src.size())) {
-        compression = compression_type::GZIP;
-        comp_data   = gz.comp_data;
-        comp_len    = gz.comp_len;
-        uncomp_len  = gz.isize;
-      }
+      if (is_gzip_member_start(src, 0, &gz)) { return decompress_gzip_members(src, 0, nullptr); }
       if (compression != compression_type::AUTO) break;
       [[fallthrough]];
     }
     case compression_type::ZIP: {
-      zip_archive_s za;
-      if (OpenZipArchive(&za, raw, src.size())) {
-        size_t cdfh_ofs = 0;
-        for (int i = 0; i < za.eocd->num_entries; i++) {
-          const zip_cdfh_s* cdfh = reinterpret_cast<const zip_cdfh_s*>(
-            reinterpret_cast<const uint8_t*>(za.cdfh) + cdfh_ofs);
-          int cdfh_len = sizeof(zip_cdfh_s) + cdfh->fname_len + cdfh->extra_len + cdfh->comment_len;
-          if (cdfh_ofs + cdfh_len > za.eocd->cdir_size || cdfh->sig != 0x02014b50) {
-            // Bad cdir
-            break;
-          }
-          // For now, only accept with non-zero file sizes and DEFLATE
-          if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0) {
-            size_t lfh_ofs       = cdfh->hdr_ofs;
-            const zip_lfh_s* lfh = reinterpret_cast<const zip_lfh_s*>(raw + lfh_ofs);
-            if (lfh_ofs + sizeof(zip_lfh_s) <= src.size() && lfh->sig == 0x04034b50 &&
-                lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len <= src.size()) {
-              if (lfh->comp_method == 8 && lfh->comp_size > 0 && lfh->uncomp_size > 0) {
-                size_t file_start = lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len;
-                size_t file_end   = file_start + lfh->comp_size;
-                if (file_end <= src.size()) {
-                  // Pick the first valid file of non-zero size (only 1 file expected in archive)
-                  compression = compression_type::ZIP;
-                  comp_data   = raw + file_start;
-                  comp_len    = lfh->comp_size;
-                  uncomp_len  = lfh->uncomp_size;
-                  break;
-                }
-              }
-            }
-          }
-          cdfh_ofs += cdfh_len;
+      auto entries = list_zip_entries(src);
+      // Directories and empty files do not contribute to the stream
+      entries.erase(std::remove_if(entries.begin(),
+                                   entries.end(),
+                                   [](auto const& entry) {
+                                     return entry.uncomp_size == 0 or entry.name.empty() or
+                                            entry.name.back() == '/';
+                                   }),
+                    entries.end());
+      if (not entries.empty()) {
+        // All entries are read as a single stream, in the order of the central directory
+        auto outputs = decompress_zip_entries(src, entries);
+        if (outputs.size() == 1) { return std::move(outputs.front()); }
+        std::vector<uint8_t> dst;
+        dst.reserve(std::accumulate(
+          outputs.cbegin(), outputs.cend(), size_t{0}, [](size_t sum, auto const& output) {
+            return sum + output.size();
+          }));
+        for (auto const& output : outputs) {
+          dst.insert(dst.end(), output.cbegin(), output.cend());
         }
+        return dst;
       }
     }
       if (compression != compression_type::AUTO) break;
@@ -362,13 +740,12 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
                                        // ~4:1 compression for initial size
   }
 
-  if (compression == compression_type::GZIP || compression == compression_type::ZIP) {
-    // INFLATE
-    std::vector<uint8_t> dst(uncomp_len);
-    cpu_inflate_vector(dst, comp_data, comp_len);
-    return dst;
-  }
   if (compression == compression_type::BZIP2) {
+    if (auto parallel_dst = cpu_bz2_uncompress_parallel(comp_data, comp_len);
+        parallel_dst.has_value()) {
+      return std::move(parallel_dst).value();
+    }
+
     size_t src_ofs = 0;
     size_t dst_ofs = 0;
     int bz_err     = 0;
@@ -395,15 +772,70 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
   CUDF_FAIL("Unsupported compressed stream type");
 }
 
+namespace {
+
+/**
+ * @brief Raw DEFLATE decompressor whose state is reused across streams.
+ *
+ * Avoids the allocation of the zlib state and window for each decompressed block.
+ */
+class inflater {
+ public:
+  inflater()
+  {
+    CUDF_EXPECTS(inflateInit2(&strm, -15) == Z_OK,  // -15 for raw data without GZIP headers
+                 "Cannot initialize DEFLATE decompressor");
+  }
+
+  ~inflater() { inflateEnd(&strm); }
+
+  inflater(inflater const&) = delete;
+  inflater& operator=(inflater const&) = delete;
+
+  /**
+   * @brief Decompresses a complete raw DEFLATE stream.
+   *
+   * @return Number of bytes written to `dst`
+   */
+  size_t inflate(host_span<uint8_t const> src, host_span<uint8_t> dst)
+  {
+    CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Cannot reset DEFLATE decompressor");
+    strm.next_in   = const_cast<Bytef*>(reinterpret_cast<Bytef const*>(src.data()));
+    strm.avail_in  = 0;
+    strm.next_out  = dst.data();
+    strm.avail_out = 0;
+    auto in_left   = src.size();
+    auto out_left  = dst.size();
+    int zerr       = Z_OK;
+    while (zerr == Z_OK) {
+      if (strm.avail_in == 0) {
+        strm.avail_in = std::min(in_left, max_zlib_chunk_size);
+        in_left -= strm.avail_in;
+      }
+      if (strm.avail_out == 0) {
+        strm.avail_out = std::min(out_left, max_zlib_chunk_size);
+        out_left -= strm.avail_out;
+      }
+      zerr = ::inflate(&strm, Z_NO_FLUSH);
+    }
+    CUDF_EXPECTS(zerr == Z_STREAM_END, "ZLIB decompression failed");
+    return strm.total_out;
+  }
+
+ private:
+  z_stream strm{};
+};
+
+}  // namespace
+
 /**
  * @brief ZLIB host decompressor (no header)
  */
 size_t decompress_zlib(host_span<uint8_t const> src, host_span<uint8_t> dst)
 {
-  size_t uncomp_size = dst.size();
-  CUDF_EXPECTS(0 == cpu_inflate(dst.data(), &uncomp_size, src.data(), src.size()),
-               "ZLIB decompression failed");
-  return uncomp_size;
+  // Each thread keeps its decompressor state between calls
+  thread_local inflater decompressor;
+  return decompressor.inflate(src, dst);
 }
 
 /**
@@ -417,6 +849,90 @@ size_t decompress_gzip(host_span<uint8_t const> src, host_span<uint8_t> dst)
   return decompress_zlib({gz.comp_data, gz.comp_len}, dst);
 }
 
+std::vector<zip_entry> list_zip_entries(host_span<uint8_t const> src)
+{
+  std::vector<zip_entry> entries;
+  zip_archive_s za;
+  if (not OpenZipArchive(&za, src.data(), src.size()) or
+      za.eocd->cdir_offset + za.eocd->cdir_size > src.size()) {
+    return entries;
+  }
+
+  auto const cdir = reinterpret_cast<uint8_t const*>(za.cdfh);
+  size_t cdfh_ofs = 0;
+  for (int i = 0; i < za.eocd->num_entries; i++) {
+    auto const cdfh = reinterpret_cast<zip_cdfh_s const*>(cdir + cdfh_ofs);
+    if (cdfh_ofs + sizeof(zip_cdfh_s) > za.eocd->cdir_size) { break; }
+    size_t const cdfh_len =
+      sizeof(zip_cdfh_s) + cdfh->fname_len + cdfh->extra_len + cdfh->comment_len;
+    if (cdfh_ofs + cdfh_len > za.eocd->cdir_size || cdfh->sig != 0x02014b50) {
+      // Bad cdir
+      break;
+    }
+    auto const fname = cdir + cdfh_ofs + sizeof(zip_cdfh_s);
+    cdfh_ofs += cdfh_len;
+
+    zip_entry entry{{reinterpret_cast<char const*>(fname), cdfh->fname_len},
+                    cdfh->comp_method,
+                    cdfh->crc32,
+                    0,
+                    cdfh->comp_size,
+                    cdfh->uncomp_size};
+    size_t lfh_ofs = cdfh->hdr_ofs;
+    // The ZIP64 extended information holds the 64-bit values of the saturated fields, in order
+    auto const extra_end = fname + cdfh->fname_len + cdfh->extra_len;
+    for (auto extra = fname + cdfh->fname_len; extra + 4 <= extra_end;) {
+      uint16_t const id   = extra[0] | (extra[1] << 8);
+      uint16_t const len  = extra[2] | (extra[3] << 8);
+      auto const data_end = std::min(extra + 4 + len, extra_end);
+      if (id == 0x0001) {
+        auto field = extra + 4;
+        for (size_t* value : {&entry.uncomp_size, &entry.comp_size, &lfh_ofs}) {
+          if (*value == 0xffff'ffff and field + 8 <= data_end) {
+            std::memcpy(value, field, 8);
+            field += 8;
+          }
+        }
+      }
+      extra += 4 + len;
+    }
+
+    if (lfh_ofs + sizeof(zip_lfh_s) > src.size()) { continue; }
+    auto const lfh = reinterpret_cast<zip_lfh_s const*>(src.data() + lfh_ofs);
+    if (lfh->sig != 0x04034b50) { continue; }
+    entry.data_offset = lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len;
+    if (entry.data_offset + entry.comp_size > src.size()) { continue; }
+    entries.push_back(std::move(entry));
+  }
+  return entries;
+}
+
+std::vector<std::vector<uint8_t>> decompress_zip_entries(host_span<uint8_t const> src,
+                                                         host_span<zip_entry const> entries)
+{
+  std::vector<std::vector<uint8_t>> outputs(entries.size());
+  for_each_index_in_pool(entries.size(), [&](size_t i) {
+    auto const& entry = entries[i];
+    CUDF_EXPECTS(entry.data_offset + entry.comp_size <= src.size(), "Invalid ZIP entry");
+    auto const comp_data = src.data() + entry.data_offset;
+    auto& dst            = outputs[i];
+    dst.resize(entry.uncomp_size);
+    switch (entry.comp_method) {
+      case 0:
+        CUDF_EXPECTS(entry.comp_size == entry.uncomp_size, "Invalid ZIP entry");
+        std::copy(comp_data, comp_data + entry.comp_size, dst.begin());
+        break;
+      case 8:
+        CUDF_EXPECTS(decompress_zlib({comp_data, entry.comp_size}, dst) == dst.size(),
+                     "Error in ZIP entry");
+        break;
+      default: CUDF_FAIL("Unsupported ZIP compression method");
+    }
+    CUDF_EXPECTS(compute_crc32(dst) == entry.crc32, "CRC mismatch in ZIP entry");
+  });
+  return outputs;
+}
+
 /**
  * @brief SNAPPY host decompressor
  */
@@ -503,41 +1019,73 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
 
 /**
  * @brief ZSTD decompressor that uses nvcomp
+ *
+ * All blocks are decompressed with a single batched nvcomp call.
  */
-size_t decompress_zstd(host_span<uint8_t const> src,
-                       host_span<uint8_t> dst,
-                       rmm::cuda_stream_view stream)
+std::vector<size_t> decompress_zstd(host_span<host_span<uint8_t const> const> srcs,
+                                    host_span<host_span<uint8_t> const> dsts,
+                                    rmm::cuda_stream_view stream)
 {
+  auto const num_blocks = srcs.size();
+
+  // Gather the blocks into one host buffer to copy them to the device at once
+  std::vector<size_t> src_offsets(num_blocks + 1, 0);
+  std::vector<size_t> dst_offsets(num_blocks + 1, 0);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    src_offsets[i + 1] = src_offsets[i] + srcs[i].size();
+    dst_offsets[i + 1] = dst_offsets[i] + dsts[i].size();
+  }
+  std::vector<uint8_t> h_src(src_offsets.back());
+  for (size_t i = 0; i < num_blocks; ++i) {
+    std::copy(srcs[i].begin(), srcs[i].end(), h_src.begin() + src_offsets[i]);
+  }
+
   // Init device span of spans (source)
-  auto const d_src = cudf::detail::make_device_uvector_async(src, stream);
-  auto hd_srcs     = hostdevice_vector<device_span<uint8_t const>>(1, stream);
-  hd_srcs[0]       = d_src;
+  auto const d_src =
+    cudf::detail::make_device_uvector_async(host_span<uint8_t const>{h_src}, stream);
+  auto hd_srcs = hostdevice_vector<device_span<uint8_t const>>(num_blocks, stream);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    hd_srcs[i] = {d_src.data() + src_offsets[i], srcs[i].size()};
+  }
   hd_srcs.host_to_device(stream);
 
   // Init device span of spans (temporary destination)
-  auto d_dst   = rmm::device_uvector<uint8_t>(dst.size(), stream);
-  auto hd_dsts = hostdevice_vector<device_span<uint8_t>>(1, stream);
-  hd_dsts[0]   = d_dst;
+  auto d_dst   = rmm::device_uvector<uint8_t>(dst_offsets.back(), stream);
+  auto hd_dsts = hostdevice_vector<device_span<uint8_t>>(num_blocks, stream);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    hd_dsts[i] = {d_dst.data() + dst_offsets[i], dsts[i].size()};
+  }
   hd_dsts.host_to_device(stream);
 
-  auto hd_stats                   = hostdevice_vector<decompress_status>(1, stream);
-  auto const max_uncomp_page_size = dst.size();
+  auto hd_stats                   = hostdevice_vector<decompress_status>(num_blocks, stream);
+  auto const max_uncomp_page_size = std::accumulate(
+    dsts.begin(), dsts.end(), size_t{0}, [](auto max, auto const& dst) {
+      return std::max(max, dst.size());
+    });
   nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
                              hd_srcs,
                              hd_dsts,
                              hd_stats,
                              max_uncomp_page_size,
-                             max_uncomp_page_size,
+                             dst_offsets.back(),
                              stream);
 
   hd_stats.device_to_host(stream, true);
-  CUDF_EXPECTS(hd_stats[0].status == 0, "ZSTD decompression failed");
 
-  // Copy temporary output to `dst`
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    dst.data(), d_dst.data(), hd_stats[0].bytes_written, cudaMemcpyDeviceToHost, stream.value()));
+  // Copy temporary output to `dsts`
+  std::vector<size_t> uncomp_sizes(num_blocks);
+  for (size_t i = 0; i < num_blocks; ++i) {
+    CUDF_EXPECTS(hd_stats[i].status == 0, "ZSTD decompression failed");
+    uncomp_sizes[i] = hd_stats[i].bytes_written;
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dsts[i].data(),
+                                  d_dst.data() + dst_offsets[i],
+                                  uncomp_sizes[i],
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+  }
+  stream.synchronize();
 
-  return hd_stats[0].bytes_written;
+  return uncomp_sizes;
 }
 
 size_t decompress(compression_type compression,
@@ -549,10 +1097,62 @@ size_t decompress(compression_type compression,
     case compression_type::GZIP: return decompress_gzip(src, dst);
     case compression_type::ZLIB: return decompress_zlib(src, dst);
     case compression_type::SNAPPY: return decompress_snappy(src, dst);
-    case compression_type::ZSTD: return decompress_zstd(src, dst, stream);
+    case compression_type::ZSTD: return decompress_zstd({&src, 1}, {&dst, 1}, stream)[0];
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
 
+namespace detail {
+
+cudf::detail::thread_pool& host_decompression_pool()
+{
+  // Zero selects the number of hardware threads
+  static cudf::detail::thread_pool pool(getenv_or("LIBCUDF_HOST_DECOMPRESSION_THREAD_COUNT", 0));
+  return pool;
+}
+
+}  // namespace detail
+
+std::vector<size_t> decompress(compression_type compression,
+                               host_span<host_span<uint8_t const> const> srcs,
+                               host_span<host_span<uint8_t> const> dsts,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(srcs.size() == dsts.size(), "Mismatched number of compressed and output blocks");
+  if (srcs.empty()) { return {}; }
+  // nvcomp decompresses all blocks in parallel on the device
+  if (compression == compression_type::ZSTD) { return decompress_zstd(srcs, dsts, stream); }
+
+  std::vector<size_t> uncomp_sizes(srcs.size());
+  auto decompress_range = [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      uncomp_sizes[i] = decompress(compression, srcs[i], dsts[i], stream);
+    }
+  };
+
+  auto& pool            = detail::host_decompression_pool();
+  auto const num_tasks  = std::min<size_t>(srcs.size(), pool.get_thread_count());
+  auto const batch_size = (srcs.size() + num_tasks - 1) / num_tasks;
+  if (num_tasks == 1) {
+    decompress_range(0, srcs.size());
+    return uncomp_sizes;
+  }
+
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(num_tasks);
+  for (size_t begin = 0; begin < srcs.size(); begin += batch_size) {
+    tasks.emplace_back(
+      pool.submit(decompress_range, begin, std::min(begin + batch_size, srcs.size())));
+  }
+  // Wait for all blocks before rethrowing any error, as the tasks reference the local state
+  for (auto& task : tasks) {
+    task.wait();
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+  return uncomp_sizes;
+}
+
 }  // namespace io
 }  // namespace cudf
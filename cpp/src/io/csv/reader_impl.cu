@@ -25,6 +25,7 @@
 #include <io/comp/io_uncomp.hpp>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/metadata_cache.hpp>
 #include <io/utilities/parsing_utils.cuh>
 #include <io/utilities/type_conversion.hpp>
 
@@ -47,6 +48,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -392,6 +394,53 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
   return {std::move(d_data), std::move(row_offsets)};
 }
 
+/**
+ * @brief Decompresses a byte range of a gzip source; the range is in uncompressed bytes.
+ *
+ * The seek index of the source is kept in the metadata cache, so that subsequent reads of the
+ * source only read and inflate the data from the closest checkpoint before the range. Without the
+ * cache, the index would be discarded, so it is not built; instead, each range reads the whole
+ * source and inflates all data before the end of the range, i.e. reading a file as N ranges costs
+ * O(N * file size).
+ */
+std::vector<uint8_t> decompress_gzip_byte_range(cudf::io::datasource* source,
+                                                size_t range_offset,
+                                                size_t range_size)
+{
+  // Checkpoints hold 32KB windows, so their overhead is ~0.2% of the uncompressed data
+  constexpr size_t gzip_index_spacing = 16 << 20;
+
+  auto& cache     = metadata_cache::instance();
+  auto const key  = cache.make_key(*source, "gzip_index");
+  auto cached_idx = cache.find<gzip_index>(key);
+  if (cached_idx != nullptr) {
+    range_offset            = std::min(range_offset, cached_idx->uncompressed_size);
+    auto const [begin, end] = gzip_index_input_range(*cached_idx, range_offset, range_size);
+    auto const buffer       = source->host_read(begin, end - begin);
+    return decompress_gzip_range(
+      {buffer->data(), buffer->size()}, begin, *cached_idx, range_offset, range_size);
+  }
+
+  auto const buffer = source->host_read(0, source->size());
+  std::vector<uint8_t> uncomp_data;
+  if (key.empty()) {
+    auto const max_size  = std::numeric_limits<size_t>::max();
+    auto const range_end =
+      range_size > max_size - range_offset ? max_size : range_offset + range_size;
+    uncomp_data = decompress_gzip_prefix({buffer->data(), buffer->size()}, range_end);
+  } else {
+    auto index = std::make_shared<gzip_index>(
+      build_gzip_index({buffer->data(), buffer->size()}, gzip_index_spacing, uncomp_data));
+    auto const index_size = index->size_bytes();
+    cache.insert(key, std::move(index), index_size);
+  }
+  range_offset = std::min(range_offset, uncomp_data.size());
+  range_size   = std::min(range_size, uncomp_data.size() - range_offset);
+  uncomp_data.erase(uncomp_data.begin() + range_offset + range_size, uncomp_data.end());
+  uncomp_data.erase(uncomp_data.begin(), uncomp_data.begin() + range_offset);
+  return uncomp_data;
+}
+
 std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_offsets(
   cudf::io::datasource* source,
   csv_reader_options const& reader_opts,
@@ -406,27 +455,38 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> select_data_and_row_
   auto skip_end_rows     = reader_opts.get_skipfooter();
   auto num_rows          = reader_opts.get_nrows();
 
+  // With gzip, the byte range refers to the uncompressed data
+  bool const gzip_byte_range = (range_offset > 0 || range_size > 0) &&
+                               reader_opts.get_compression() == compression_type::GZIP;
   if (range_offset > 0 || range_size > 0) {
-    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE,
+    CUDF_EXPECTS(reader_opts.get_compression() == compression_type::NONE || gzip_byte_range,
                  "Reading compressed data using `byte range` is unsupported");
   }
 
   // Transfer source data to GPU
   if (!source->is_empty()) {
-    auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
-    auto buffer    = source->host_read(range_offset, data_size);
-
-    auto h_data = host_span<char const>(  //
-      reinterpret_cast<const char*>(buffer->data()),
-      buffer->size());
-
+    std::unique_ptr<datasource::buffer> buffer;
     std::vector<uint8_t> h_uncomp_data_owner;
+    host_span<char const> h_data;
 
-    if (reader_opts.get_compression() != compression_type::NONE) {
-      h_uncomp_data_owner =
-        decompress(reader_opts.get_compression(), {buffer->data(), buffer->size()});
+    if (gzip_byte_range) {
+      h_uncomp_data_owner = decompress_gzip_byte_range(
+        source,
+        range_offset,
+        (range_size_padded != 0) ? range_size_padded : std::numeric_limits<size_t>::max());
       h_data = {reinterpret_cast<char const*>(h_uncomp_data_owner.data()),
                 h_uncomp_data_owner.size()};
+    } else {
+      auto data_size = (range_size_padded != 0) ? range_size_padded : source->size();
+      buffer         = source->host_read(range_offset, data_size);
+      h_data         = {reinterpret_cast<const char*>(buffer->data()), buffer->size()};
+
+      if (reader_opts.get_compression() != compression_type::NONE) {
+        h_uncomp_data_owner =
+          decompress(reader_opts.get_compression(), {buffer->data(), buffer->size()});
+        h_data = {reinterpret_cast<char const*>(h_uncomp_data_owner.data()),
+                  h_uncomp_data_owner.size()};
+      }
     }
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
@@ -665,9 +725,28 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
   return active_col_types;
 }
 
+/**
+ * @brief Columns of a CSV dataset, as determined by the first chunk of a chunked read
+ */
+struct column_schema {
+  bool has_columns = false;
+  std::vector<std::string> column_names;
+  std::vector<column_parse::flags> column_flags;
+  int32_t num_active_columns = 0;
+  std::vector<data_type> column_types;  // Types of the active columns; empty until known
+};
+
+/**
+ * @brief Reads a CSV dataset
+ *
+ * @param schema Columns of the previous chunks of a chunked read, used instead of the header and
+ * of the inferred types once known, and updated from this chunk otherwise; `nullptr` if the read
+ * is not chunked
+ */
 table_with_metadata read_csv(cudf::io::datasource* source,
                              csv_reader_options const& reader_opts,
                              parse_options const& parse_opts,
+                             column_schema* schema,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
@@ -686,8 +765,14 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   auto num_actual_columns = static_cast<int32_t>(reader_opts.get_names().size());
   auto num_active_columns = num_actual_columns;
 
-  // Check if the user gave us a list of column names
-  if (not reader_opts.get_names().empty()) {
+  // Later chunks of a chunked read keep the columns of the first chunk
+  if (schema != nullptr && schema->has_columns) {
+    column_names       = schema->column_names;
+    column_flags       = schema->column_flags;
+    num_actual_columns = column_names.size();
+    num_active_columns = schema->num_active_columns;
+  } else if (not reader_opts.get_names().empty()) {
+    // The user gave us a list of column names
     column_flags.resize(reader_opts.get_names().size(),
                         column_parse::enabled | column_parse::inferred);
     column_names = reader_opts.get_names();
@@ -810,11 +895,31 @@ table_with_metadata read_csv(cudf::io::datasource* source,
     }
   }
 
+  if (schema != nullptr && not schema->has_columns) {
+    schema->has_columns        = true;
+    schema->column_names       = column_names;
+    schema->column_flags       = column_flags;
+    schema->num_active_columns = num_active_columns;
+  }
+
   // Return empty table rather than exception if nothing to load
   if (num_active_columns == 0) { return {std::make_unique<table>(), {}}; }
 
-  auto const column_types = determine_column_types(
-    reader_opts, parse_opts, column_names, data, row_offsets, num_records, column_flags, stream);
+  bool const has_types    = schema != nullptr && not schema->column_types.empty();
+  auto const column_types = has_types ? schema->column_types
+                                      : determine_column_types(reader_opts,
+                                                               parse_opts,
+                                                               column_names,
+                                                               data,
+                                                               row_offsets,
+                                                               num_records,
+                                                               column_flags,
+                                                               stream);
+  // Types inferred from an empty chunk are not kept
+  if (schema != nullptr && not has_types && num_records != 0) {
+    schema->column_flags = column_flags;
+    schema->column_types = column_types;
+  }
 
   auto metadata    = table_metadata{};
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
@@ -971,9 +1076,97 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
 {
   auto parse_options = make_parse_options(options, stream);
 
-  return read_csv(source.get(), options, parse_options, stream, mr);
+  return read_csv(source.get(), options, parse_options, nullptr, stream, mr);
+}
+
+/**
+ * @brief Implementation for the chunked CSV reader
+ */
+class chunked_reader::impl {
+ public:
+  impl(std::size_t chunk_read_size,
+       std::unique_ptr<cudf::io::datasource>&& source,
+       csv_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _chunk_read_size(chunk_read_size),
+      _source(std::move(source)),
+      _options(options),
+      _parse_options(make_parse_options(options, stream)),
+      _stream(stream),
+      _mr(mr)
+  {
+    CUDF_EXPECTS(chunk_read_size > 0, "Chunk read size must be positive");
+    CUDF_EXPECTS(options.get_compression() == compression_type::NONE,
+                 "Reading compressed data in chunks is unsupported");
+    CUDF_EXPECTS(options.get_byte_range_offset() == 0 && options.get_byte_range_size() == 0 &&
+                   options.get_skiprows() <= 0 && options.get_skipfooter() <= 0 &&
+                   options.get_nrows() == -1,
+                 "Selecting rows is unsupported when reading in chunks");
+  }
+
+  [[nodiscard]] bool has_next() const { return not _has_read || _offset < _source->size(); }
+
+  table_with_metadata read_chunk()
+  {
+    CUDF_EXPECTS(has_next(), "No more chunks to read");
+
+    while (true) {
+      auto options = _options;
+      // Once the columns are known, the header row and the column selection are not parsed again,
+      // and once their types are known, they are not inferred again
+      if (_schema.has_columns) {
+        options.set_header(-1);
+        options.set_names({});
+        options.set_use_cols_names({});
+        options.set_use_cols_indexes({});
+        options.set_parse_dates(std::vector<std::string>{});
+        options.set_parse_dates(std::vector<int>{});
+        options.set_parse_hex(std::vector<std::string>{});
+        options.set_parse_hex(std::vector<int>{});
+      }
+      if (not _schema.column_types.empty()) { options.set_dtypes(std::vector<data_type>{}); }
+      options.set_byte_range_offset(_offset);
+      options.set_byte_range_size(_chunk_read_size);
+      _offset += std::min(_chunk_read_size, _source->size() - _offset);
+      _has_read = true;
+
+      auto result = read_csv(_source.get(), options, _parse_options, &_schema, _stream, _mr);
+      if (result.tbl->num_rows() != 0 || not has_next()) { return result; }
+    }
+  }
+
+ private:
+  std::size_t const _chunk_read_size;
+  std::unique_ptr<cudf::io::datasource> _source;
+  csv_reader_options const _options;
+  parse_options const _parse_options;
+  rmm::cuda_stream_view const _stream;
+  rmm::mr::device_memory_resource* const _mr;
+
+  bool _has_read      = false;
+  std::size_t _offset = 0;  // Offset of the next byte range to read
+  column_schema _schema;
+};
+
+chunked_reader::chunked_reader(std::size_t chunk_read_size,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               csv_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl(std::make_unique<impl>(chunk_read_size, std::move(source), options, stream, mr))
+{
 }
 
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(); }
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -220,6 +220,46 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
     mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(std::size_t chunk_read_size,
+                                       csv_reader_options options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  options.set_compression(infer_compression_type(options.get_compression(), options.get_source()));
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  reader = std::make_unique<cudf::io::detail::csv::chunked_reader>(
+    chunk_read_size, std::move(datasources[0]), options, cudf::default_stream_value, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -420,6 +460,46 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               std::size_t pass_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            pass_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_row_group_metadata
  */
@@ -248,6 +248,46 @@ std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stri
   return selected_stripes_mapping;
 }
 
+std::vector<RowIndex> aggregate_orc_metadata::read_row_indexes(
+  int source_idx,
+  size_type stripe_idx,
+  std::vector<size_type> const& column_ids,
+  rmm::cuda_stream_view stream) const
+{
+  auto const& pfm    = per_file_metadata[source_idx];
+  auto const& stripe = pfm.ff.stripes[stripe_idx];
+  std::vector<RowIndex> row_indexes(column_ids.size());
+  if (stripe.indexLength == 0 or column_ids.empty()) { return row_indexes; }
+
+  const auto sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  CUDF_EXPECTS(sf_comp_offset + stripe.footerLength < pfm.source->size(),
+               "Invalid stripe information");
+  const auto sf_buffer = pfm.source->host_read(sf_comp_offset, stripe.footerLength);
+  const auto sf_data =
+    pfm.decompressor->decompress_blocks({sf_buffer->data(), sf_buffer->size()}, stream);
+  StripeFooter stripe_footer;
+  ProtobufReader(sf_data.data(), sf_data.size()).read(stripe_footer);
+
+  // Index streams come first in the stripe, in the order of the footer's stream list
+  const auto index_buffer = pfm.source->host_read(stripe.offset, stripe.indexLength);
+  uint64_t src_offset     = 0;
+  for (auto const& stream_desc : stripe_footer.streams) {
+    if (src_offset + stream_desc.length > index_buffer->size()) { break; }
+    auto const col_it = std::find(column_ids.cbegin(),
+                                  column_ids.cend(),
+                                  static_cast<size_type>(stream_desc.column_id.value_or(0)));
+    if (stream_desc.kind == ROW_INDEX and col_it != column_ids.cend()) {
+      const auto index_data = pfm.decompressor->decompress_blocks(
+        {index_buffer->data() + src_offset, stream_desc.length}, stream);
+      ProtobufReader(index_data.data(), index_data.size())
+        .read(row_indexes[std::distance(column_ids.cbegin(), col_it)]);
+    }
+    src_offset += stream_desc.length;
+  }
+
+  return row_indexes;
+}
+
 column_hierarchy aggregate_orc_metadata::select_columns(
   std::vector<std::string> const& column_paths)
 {
@@ -120,6 +120,20 @@ class aggregate_orc_metadata {
     size_type& row_count,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Reads the row index of the given columns of a stripe.
+   *
+   * @param source_idx Index of the source that contains the stripe
+   * @param stripe_idx Index of the stripe within its source
+   * @param column_ids ORC column IDs of the columns whose row index is read
+   * @param stream CUDA stream used for decompression
+   * @return Row index of each column; empty for columns without a row index stream
+   */
+  std::vector<RowIndex> read_row_indexes(int source_idx,
+                                         size_type stripe_idx,
+                                         std::vector<size_type> const& column_ids,
+                                         rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
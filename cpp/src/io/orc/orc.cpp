@@ -18,10 +18,13 @@
 #include "orc_field_reader.hpp"
 #include "orc_field_writer.hpp"
 
+#include <io/utilities/metadata_cache.hpp>
+
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <thrust/tabulate.h>
 
+#include <memory>
 #include <string>
 
 namespace cudf {
@@ -200,6 +203,19 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_packed_field_reader(1, s.positions),
+                            make_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -417,8 +433,18 @@ host_span<uint8_t const> OrcDecompressor::decompress_blocks(host_span<uint8_t co
   // Check if we have a single uncompressed block, or no blocks
   if (max_dst_length < m_blockSize) { return src.subspan(header_size, src.size() - header_size); }
 
+  // Lay out the blocks at their worst-case output offsets, so that the compressed blocks can be
+  // decompressed in parallel
+  struct block_layout {
+    size_t offset;
+    size_t size;  // Known after decompression for compressed blocks
+    bool is_compressed;
+  };
+  std::vector<block_layout> blocks;
+  std::vector<host_span<uint8_t const>> comp_blocks;
+  std::vector<host_span<uint8_t>> uncomp_blocks;
   m_buf.resize(max_dst_length);
-  size_t dst_length = 0;
+  size_t max_dst_offset = 0;
   for (size_t i = 0; i + header_size < src.size();) {
     uint32_t block_len         = src[i] | (src[i + 1] << 8) | (src[i + 2] << 16);
     auto const is_uncompressed = static_cast<bool>(block_len & 1);
@@ -426,22 +452,92 @@ host_span<uint8_t const> OrcDecompressor::decompress_blocks(host_span<uint8_t co
     block_len >>= 1;
     if (is_uncompressed) {
       // Uncompressed block
-      memcpy(m_buf.data() + dst_length, src.data() + i, block_len);
-      dst_length += block_len;
+      memcpy(m_buf.data() + max_dst_offset, src.data() + i, block_len);
+      blocks.push_back({max_dst_offset, block_len, false});
+      max_dst_offset += block_len;
     } else {
       // Compressed block
-      dst_length += decompress(
-        _compression, src.subspan(i, block_len), {m_buf.data() + dst_length, m_blockSize}, stream);
+      comp_blocks.push_back(src.subspan(i, block_len));
+      uncomp_blocks.push_back({m_buf.data() + max_dst_offset, m_blockSize});
+      blocks.push_back({max_dst_offset, 0, true});
+      max_dst_offset += m_blockSize;
     }
     i += block_len;
   }
+  auto const uncomp_sizes = decompress(_compression, comp_blocks, uncomp_blocks, stream);
+
+  // Remove the gaps between blocks; blocks only move towards the start of the buffer
+  size_t dst_length = 0;
+  auto uncomp_size  = uncomp_sizes.cbegin();
+  for (auto const& block : blocks) {
+    auto const block_size = block.is_compressed ? *uncomp_size++ : block.size;
+    if (dst_length != block.offset) {
+      memmove(m_buf.data() + dst_length, m_buf.data() + block.offset, block_size);
+    }
+    dst_length += block_size;
+  }
 
   m_buf.resize(dst_length);
   return m_buf;
 }
 
+namespace {
+/**
+ * @brief File-level metadata sections, as kept in the metadata cache
+ */
+struct file_metadata {
+  PostScript ps;
+  FileFooter ff;
+  Metadata md;
+};
+
+/**
+ * @brief Returns an estimate of the host memory used by decoded metadata sections, in bytes
+ *
+ * Decoded metadata is larger than its compressed encoding, so this is the size charged to the
+ * metadata cache.
+ */
+std::size_t decoded_size(file_metadata const& meta)
+{
+  auto const& [ps, ff, md] = meta;
+  auto size = sizeof(meta) + ps.version.size() * sizeof(uint32_t) + ps.magic.size() +
+              ff.stripes.size() * sizeof(StripeInformation);
+  for (auto const& type : ff.types) {
+    size += sizeof(type) + type.subtypes.size() * sizeof(uint32_t);
+    for (auto const& name : type.fieldNames) {
+      size += sizeof(name) + name.size();
+    }
+  }
+  for (auto const& item : ff.metadata) {
+    size += sizeof(item) + item.name.size() + item.value.size();
+  }
+  for (auto const& blob : ff.statistics) {
+    size += sizeof(blob) + blob.size();
+  }
+  for (auto const& stripe_stats : md.stripeStats) {
+    size += sizeof(stripe_stats);
+    for (auto const& blob : stripe_stats.colStats) {
+      size += sizeof(blob) + blob.size();
+    }
+  }
+  return size;
+}
+}  // namespace
+
 metadata::metadata(datasource* const src, rmm::cuda_stream_view stream) : source(src)
 {
+  auto& cache          = cudf::io::detail::metadata_cache::instance();
+  auto const cache_key = cache.make_key(*source, "orc");
+  if (auto const cached = cache.find<file_metadata>(cache_key); cached != nullptr) {
+    ps           = cached->ps;
+    ff           = cached->ff;
+    md           = cached->md;
+    decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+    init_parent_descriptors();
+    init_column_names();
+    return;
+  }
+
   const auto len         = source->size();
   const auto max_ps_size = std::min(len, static_cast<size_t>(256));
 
@@ -468,6 +564,10 @@ metadata::metadata(datasource* const src, rmm::cuda_stream_view stream) : source
   auto const md_data = decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
   orc::ProtobufReader(md_data.data(), md_data.size()).read(md);
 
+  auto cached_metadata = std::make_shared<file_metadata const>(file_metadata{ps, ff, md});
+  auto const cached_size = decoded_size(*cached_metadata);
+  cache.insert(cache_key, std::move(cached_metadata), cached_size);
+
   init_parent_descriptors();
   init_column_names();
 }
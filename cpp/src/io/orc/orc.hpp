@@ -133,6 +133,15 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;               // positions of the row group in the streams
+  std::optional<column_statistics> statistics;  // statistics of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -220,6 +229,8 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
 
  private:
   template <int index>
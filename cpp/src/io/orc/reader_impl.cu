@@ -28,6 +28,7 @@
 #include <io/comp/gpuinflate.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/thread_pool.hpp>
 #include <io/utilities/time_utils.cuh>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -53,7 +54,11 @@
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <future>
 #include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
 
 namespace cudf {
 namespace io {
@@ -260,6 +265,111 @@ auto decimal_column_type(std::vector<std::string> const& decimal128_columns,
   return type_id::DECIMAL128;
 }
 
+/**
+ * @brief Converts a range of milliseconds since epoch to the given timestamp resolution.
+ *
+ * ORC statistics truncate timestamps to milliseconds, so the range is widened by a millisecond on
+ * each side before the conversion.
+ *
+ * @return Converted range; `nullopt` if the range cannot be represented in the resolution
+ */
+std::optional<std::pair<int64_t, int64_t>> convert_millisecond_range(int64_t min_ms,
+                                                                     int64_t max_ms,
+                                                                     type_id timestamp_type_id)
+{
+  constexpr int64_t ms_per_day = 24 * 60 * 60 * 1000;
+  auto const floor_div         = [](int64_t value, int64_t divisor) {
+    return value / divisor - static_cast<int64_t>(value % divisor < 0);
+  };
+  auto const multiply = [](int64_t min, int64_t max, int64_t factor) {
+    constexpr auto limit = std::numeric_limits<int64_t>::max();
+    if (min < -limit / factor or max > limit / factor) {
+      return std::optional<std::pair<int64_t, int64_t>>{};
+    }
+    return std::optional<std::pair<int64_t, int64_t>>{std::pair{min * factor, max * factor}};
+  };
+  if (min_ms == std::numeric_limits<int64_t>::min() or
+      max_ms == std::numeric_limits<int64_t>::max()) {
+    return std::nullopt;
+  }
+  min_ms -= 1;
+  max_ms += 1;
+
+  switch (timestamp_type_id) {
+    case type_id::TIMESTAMP_DAYS:
+      return std::pair{floor_div(min_ms, ms_per_day), floor_div(max_ms, ms_per_day)};
+    case type_id::TIMESTAMP_SECONDS:
+      return std::pair{floor_div(min_ms, 1000), floor_div(max_ms, 1000)};
+    case type_id::TIMESTAMP_MILLISECONDS: return std::pair{min_ms, max_ms};
+    case type_id::TIMESTAMP_MICROSECONDS: return multiply(min_ms, max_ms, 1000);
+    case type_id::TIMESTAMP_NANOSECONDS: return multiply(min_ms, max_ms, 1000000);
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Converts the ORC statistics of a column over a block of rows to the statistics used to
+ * evaluate filters.
+ *
+ * Only values of the types that are read without conversion are used; min/max of other columns
+ * are left unknown.
+ */
+cudf::io::detail::column_block_stats to_block_stats(
+  cudf::io::orc::column_statistics const& stats, data_type type, int64_t num_rows)
+{
+  cudf::io::detail::column_block_stats block_stats{type};
+  // `number_of_values` does not count nulls
+  if (stats.number_of_values.has_value()) {
+    block_stats.null_count = num_rows - static_cast<int64_t>(stats.number_of_values.value());
+  }
+
+  auto const set_range = [&](auto min, auto max) {
+    block_stats.min = min;
+    block_stats.max = max;
+  };
+  auto const id = type.id();
+  if (stats.int_stats.has_value() and is_integral(type) and id != type_id::BOOL8 and
+      not is_unsigned(type)) {
+    auto const& int_stats = stats.int_stats.value();
+    if (int_stats.minimum.has_value() and int_stats.maximum.has_value()) {
+      set_range(int_stats.minimum.value(), int_stats.maximum.value());
+    }
+  } else if (stats.double_stats.has_value() and is_floating_point(type)) {
+    auto const& double_stats = stats.double_stats.value();
+    if (double_stats.minimum.has_value() and double_stats.maximum.has_value()) {
+      set_range(double_stats.minimum.value(), double_stats.maximum.value());
+    }
+  } else if (stats.bucket_stats.has_value() and id == type_id::BOOL8) {
+    // The only bucket holds the number of `true` values
+    auto const& counts = stats.bucket_stats.value().count;
+    if (not counts.empty() and stats.number_of_values.value_or(0) > 0) {
+      auto const num_true = counts.front();
+      set_range(int64_t{num_true == stats.number_of_values.value()}, int64_t{num_true > 0});
+    }
+  } else if (stats.date_stats.has_value() and is_timestamp(type)) {
+    auto const& date_stats = stats.date_stats.value();
+    if (date_stats.minimum.has_value() and date_stats.maximum.has_value()) {
+      if (id == type_id::TIMESTAMP_DAYS) {
+        set_range(int64_t{date_stats.minimum.value()}, int64_t{date_stats.maximum.value()});
+      } else {
+        constexpr int64_t ms_per_day = 24 * 60 * 60 * 1000;
+        auto const range             = convert_millisecond_range(
+          date_stats.minimum.value() * ms_per_day, date_stats.maximum.value() * ms_per_day, id);
+        if (range.has_value()) { set_range(range->first, range->second); }
+      }
+    }
+  } else if (stats.timestamp_stats.has_value() and is_timestamp(type)) {
+    // Timestamps are read as UTC
+    auto const& ts_stats = stats.timestamp_stats.value();
+    if (ts_stats.minimum_utc.has_value() and ts_stats.maximum_utc.has_value()) {
+      auto const range =
+        convert_millisecond_range(ts_stats.minimum_utc.value(), ts_stats.maximum_utc.value(), id);
+      if (range.has_value()) { set_range(range->first, range->second); }
+    }
+  }
+  return block_stats;
+}
+
 }  // namespace
 
 __global__ void decompress_check_kernel(device_span<decompress_status const> stats,
@@ -899,6 +1009,109 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   // Control decimals conversion
   decimal128_columns = options.get_decimal128_columns();
+
+  _filter = options.get_filter();
+}
+
+std::vector<std::vector<size_type>> reader::impl::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes, rmm::cuda_stream_view stream)
+{
+  auto const filter          = cudf::io::detail::stats_filter(_filter.value().get(), stream);
+  auto const& column_indices = filter.get_column_indices();
+  auto const& columns        = selected_columns.levels[0];
+
+  // Statistics of the columns that are not used by the filter are left unknown
+  std::vector<cudf::io::detail::column_block_stats> unknown_stats(columns.size());
+  std::vector<size_type> filter_col_ids;
+  for (auto const col_idx : column_indices) {
+    CUDF_EXPECTS(col_idx >= 0 and static_cast<size_t>(col_idx) < columns.size(),
+                 "Filter column index is out of range");
+    auto const col_id   = columns[col_idx].id;
+    auto const col_type = to_type_id(_metadata.get_col_type(col_id),
+                                     _use_np_dtypes,
+                                     _timestamp_type.id(),
+                                     decimal_column_type(decimal128_columns, _metadata, col_id));
+    // Literals compared to decimal columns must match their scale, as in the output table
+    auto const scale = is_fixed_point(data_type{col_type})
+                         ? -static_cast<size_type>(_metadata.get_col_type(col_id).scale.value_or(0))
+                         : 0;
+    unknown_stats[col_idx].type = data_type{col_type, scale};
+    filter_col_ids.push_back(col_id);
+  }
+
+  auto const may_contain_matches =
+    [&](std::vector<std::optional<cudf::io::orc::column_statistics>> const& col_stats,
+        int64_t num_rows) {
+      auto block_stats = unknown_stats;
+      for (size_t i = 0; i < column_indices.size(); ++i) {
+        if (col_stats[i].has_value()) {
+          auto& stats = block_stats[column_indices[i]];
+          stats       = to_block_stats(col_stats[i].value(), stats.type, num_rows);
+        }
+      }
+      return filter.may_contain_matches(block_stats, num_rows);
+    };
+
+  std::vector<std::vector<size_type>> selected(_metadata.per_file_metadata.size());
+  for (size_t src_idx = 0; src_idx < selected.size(); ++src_idx) {
+    auto const& pfm = _metadata.per_file_metadata[src_idx];
+    std::vector<size_type> candidates(pfm.get_num_stripes());
+    if (stripes.empty()) {
+      std::iota(candidates.begin(), candidates.end(), 0);
+    } else {
+      CUDF_EXPECTS(stripes.size() == selected.size(), "Must specify stripes for each source");
+      candidates = stripes[src_idx];
+    }
+
+    for (auto const stripe_idx : candidates) {
+      // Invalid indices are reported when the stripes are selected
+      if (stripe_idx < 0 or stripe_idx >= pfm.get_num_stripes()) {
+        selected[src_idx].push_back(stripe_idx);
+        continue;
+      }
+      int64_t const num_rows = pfm.ff.stripes[stripe_idx].numberOfRows;
+
+      // Stripe statistics are optional
+      if (static_cast<size_t>(stripe_idx) < pfm.md.stripeStats.size()) {
+        auto const& blobs = pfm.md.stripeStats[stripe_idx].colStats;
+        std::vector<std::optional<cudf::io::orc::column_statistics>> col_stats(
+          filter_col_ids.size());
+        for (size_t i = 0; i < filter_col_ids.size(); ++i) {
+          if (static_cast<size_t>(filter_col_ids[i]) >= blobs.size()) { continue; }
+          auto const& blob = blobs[filter_col_ids[i]];
+          col_stats[i].emplace();
+          ProtobufReader(blob.data(), blob.size()).read(col_stats[i].value());
+        }
+        if (not may_contain_matches(col_stats, num_rows)) { continue; }
+      }
+
+      // Statistics of the row groups, from the row index
+      auto const row_index_stride = pfm.get_row_index_stride();
+      if (row_index_stride > 0 and not filter_col_ids.empty()) {
+        auto const row_indexes =
+          _metadata.read_row_indexes(src_idx, stripe_idx, filter_col_ids, stream);
+        auto const num_row_groups = util::div_rounding_up_unsafe(num_rows, row_index_stride);
+        auto any_match            = num_row_groups == 0;
+        for (int64_t rg_idx = 0; rg_idx < num_row_groups and not any_match; ++rg_idx) {
+          std::vector<std::optional<cudf::io::orc::column_statistics>> col_stats(
+            filter_col_ids.size());
+          for (size_t i = 0; i < filter_col_ids.size(); ++i) {
+            auto const& entries = row_indexes[i].entry;
+            if (static_cast<size_t>(rg_idx) < entries.size()) {
+              col_stats[i] = entries[rg_idx].statistics;
+            }
+          }
+          auto const rg_num_rows =
+            std::min<int64_t>(row_index_stride, num_rows - rg_idx * row_index_stride);
+          any_match = may_contain_matches(col_stats, rg_num_rows);
+        }
+        if (not any_match) { continue; }
+      }
+
+      selected[src_idx].push_back(stripe_idx);
+    }
+  }
+  return selected;
 }
 
 timezone_table reader::impl::compute_timezone_table(
@@ -915,7 +1128,14 @@ timezone_table reader::impl::compute_timezone_table(
     });
   if (not has_timestamp_column) return {};
 
-  return build_timezone_transition_table(selected_stripes[0].stripe_info[0].second->writerTimezone,
+  // Sources may have no selected stripes when stripes are filtered
+  auto const first_mapping =
+    std::find_if(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (first_mapping == selected_stripes.cend()) return {};
+
+  return build_timezone_transition_table(first_mapping->stripe_info[0].second->writerTimezone,
                                          stream);
 }
 
@@ -942,7 +1162,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     return {std::make_unique<table>(), std::move(out_metadata)};
 
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows, stream);
+  const auto selected_stripes = _metadata.select_stripes(
+    _filter.has_value() ? filter_stripes(stripes, stream) : stripes, skip_rows, num_rows, stream);
 
   auto const tz_table = compute_timezone_table(selected_stripes, stream);
 
@@ -1038,6 +1259,18 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       int stripe_idx          = 0;
 
       std::vector<std::pair<std::future<size_t>, size_t>> read_tasks;
+      // Host reads of a stripe proceed on a background thread while the following stripes are set
+      // up. The thread reads one stripe at a time, so the source never sees concurrent reads, and
+      // the setup waits if it gets more than `max_stripe_lookahead` stripes ahead of the reads.
+      constexpr size_t max_stripe_lookahead = 2;
+      using host_buffers                    = std::vector<std::unique_ptr<datasource::buffer>>;
+      struct host_read_task {
+        std::shared_future<host_buffers> buffers;
+        std::vector<datasource::read_range> ranges;
+        std::vector<uint8_t*> dsts;
+      };
+      std::vector<host_read_task> host_read_tasks;
+      std::unique_ptr<cudf::detail::thread_pool> host_reader;  // Created on the first host read
       for (auto const& stripe_source_mapping : selected_stripes) {
         // Iterate through the source files selected stripes
         for (auto const& stripe : stripe_source_mapping.stripe_info) {
@@ -1070,6 +1303,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           auto dst_base = static_cast<uint8_t*>(stripe_data.back().data());
 
           // Coalesce consecutive streams into one read
+          auto& source = _metadata.per_file_metadata[stripe_source_mapping.source_idx].source;
+          std::vector<datasource::read_range> host_ranges;
+          std::vector<uint8_t*> host_dsts;
           while (not is_data_empty and stream_count < stream_info.size()) {
             const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
             const auto offset = stream_info[stream_count].offset;
@@ -1081,23 +1317,31 @@ table_with_metadata reader::impl::read(size_type skip_rows,
               len += stream_info[stream_count].length;
               stream_count++;
             }
-            if (_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                  .source->is_device_read_preferred(len)) {
+            if (source->is_device_read_preferred(len)) {
               read_tasks.push_back(
-                std::pair(_metadata.per_file_metadata[stripe_source_mapping.source_idx]
-                            .source->device_read_async(offset, len, d_dst, stream),
-                          len));
+                std::pair(source->device_read_async(offset, len, d_dst, stream), len));
 
             } else {
-              const auto buffer =
-                _metadata.per_file_metadata[stripe_source_mapping.source_idx].source->host_read(
-                  offset, len);
-              CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
-              CUDF_CUDA_TRY(cudaMemcpyAsync(
-                d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
+              host_ranges.push_back({offset, len});
+              host_dsts.push_back(d_dst);
             }
           }
+          if (not host_ranges.empty()) {
+            // Streams that are not adjacent can still be merged, and read in parallel, by the
+            // source
+            if (host_reader == nullptr) {
+              host_reader = std::make_unique<cudf::detail::thread_pool>(1);
+            }
+            if (host_read_tasks.size() >= max_stripe_lookahead) {
+              host_read_tasks[host_read_tasks.size() - max_stripe_lookahead].buffers.wait();
+            }
+            auto read_stripe = [source, ranges = host_ranges] {
+              return source->host_read_ranges(ranges);
+            };
+            auto buffers = host_reader->submit(read_stripe).share();
+            host_read_tasks.push_back(
+              {std::move(buffers), std::move(host_ranges), std::move(host_dsts)});
+          }
 
           const auto num_rows_per_stripe = stripe_info->numberOfRows;
           const auto rowgroup_id         = num_rowgroups;
@@ -1163,6 +1407,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       for (auto& task : read_tasks) {
         CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
       }
+      for (auto& task : host_read_tasks) {
+        auto const& buffers = task.buffers.get();
+        for (size_t i = 0; i < buffers.size(); ++i) {
+          CUDF_EXPECTS(buffers[i]->size() == task.ranges[i].size,
+                       "Unexpected discrepancy in bytes read.");
+          CUDF_CUDA_TRY(cudaMemcpyAsync(task.dsts[i],
+                                        buffers[i]->data(),
+                                        task.ranges[i].size,
+                                        cudaMemcpyHostToDevice,
+                                        stream.value()));
+        }
+      }
+      // The buffers in host_read_tasks must outlive the copies
+      if (not host_read_tasks.empty()) { stream.synchronize(); }
 
       // Process dataset chunk pages into output columns
       if (stripe_data.size() != 0) {
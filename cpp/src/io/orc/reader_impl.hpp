@@ -22,6 +22,7 @@
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/stats_filter.hpp>
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/orc.hpp>
@@ -29,7 +30,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -103,6 +106,20 @@ class reader::impl {
                            rmm::cuda_stream_view stream);
 
  private:
+  /**
+   * @brief Selects the stripes that may contain rows that satisfy the filter.
+   *
+   * Stripes are ruled out using the stripe statistics, then using the statistics of their row
+   * groups when the stripe has a row index.
+   *
+   * @param stripes Indices of individual stripes to load if non-empty; all stripes otherwise
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Indices of the stripes to load from each source
+   */
+  std::vector<std::vector<size_type>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes, rmm::cuda_stream_view stream);
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
@@ -224,6 +241,7 @@ class reader::impl {
   bool _use_np_dtypes{true};
   std::vector<std::string> decimal128_columns;
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   reader_column_meta _col_meta{};
 };
 
@@ -73,12 +73,6 @@ struct row_group_index_info {
 };
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  */
@@ -1429,7 +1423,6 @@ void writer::impl::write_index_stream(int32_t stripe_id,
 std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
                                                   gpu::encoder_chunk_streams const& enc_stream,
                                                   uint8_t const* compressed_data,
-                                                  uint8_t* stream_out,
                                                   StripeInformation* stripe,
                                                   orc_streams* streams)
 {
@@ -1446,11 +1439,13 @@ std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_
     if (out_sink_->is_device_write_preferred(length)) {
       return out_sink_->device_write_async(stream_in, length, stream);
     } else {
-      CUDF_CUDA_TRY(
-        cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
+      // The write is queued and overlaps the encoding of the following streams
+      auto stream_out = out_sink_->get_buffer(length);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        stream_out.data(), stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
       stream.synchronize();
 
-      out_sink_->host_write(stream_out, length);
+      out_sink_->host_write(std::move(stream_out), length);
       return std::async(std::launch::deferred, [] {});
     }
   }();
@@ -1492,7 +1487,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
-    out_sink_(std::move(sink))
+    out_sink_(make_queued_sink(std::move(sink)))
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
@@ -1514,7 +1509,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     stats_freq_(options.get_statistics_freq()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
-    out_sink_(std::move(sink))
+    out_sink_(make_queued_sink(std::move(sink)))
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
@@ -2138,37 +2133,17 @@ void writer::impl::write(table_view const& table)
     auto const max_compressed_block_size =
       get_compress_max_output_chunk_size(compression_kind_, compression_blocksize_);
 
-    auto stream_output = [&]() {
-      size_t max_stream_size = 0;
-      bool all_device_write  = true;
-
-      for (auto& ss : strm_descs.host_view().flat_view()) {
-        if (!out_sink_->is_device_write_preferred(ss.stream_size)) { all_device_write = false; }
-        size_t stream_size = ss.stream_size;
-        if (compression_kind_ != NONE) {
-          ss.first_block = num_compressed_blocks;
-          ss.bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * block_header_size;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += compressed_block_size(max_compressed_block_size) * num_blocks;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
-      }
+    for (auto& ss : strm_descs.host_view().flat_view()) {
+      if (compression_kind_ != NONE) {
+        ss.first_block = num_compressed_blocks;
+        ss.bfr_offset  = compressed_bfr_size;
 
-      if (all_device_write) {
-        return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-      } else {
-        return pinned_buffer<uint8_t>{[](size_t size) {
-                                        uint8_t* ptr = nullptr;
-                                        CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                        return ptr;
-                                      }(max_stream_size),
-                                      cudaFreeHost};
+        auto num_blocks = std::max<uint32_t>(
+          (ss.stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+        num_compressed_blocks += num_blocks;
+        compressed_bfr_size += compressed_block_size(max_compressed_block_size) * num_blocks;
       }
-    }();
+    }
 
     // Compress the data streams
     rmm::device_buffer compressed_data(compressed_bfr_size, stream);
@@ -2229,7 +2204,6 @@ void writer::impl::write(table_view const& table)
           strm_desc,
           enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first],
           static_cast<uint8_t const*>(compressed_data.data()),
-          stream_output.get(),
           &stripe,
           &streams));
       }
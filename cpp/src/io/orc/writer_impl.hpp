@@ -20,6 +20,7 @@
 #include "orc_gpu.hpp"
 
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/queued_sink.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -402,7 +403,6 @@ class writer::impl {
    * @param[in] strm_desc Stream's descriptor
    * @param[in] enc_stream Chunk's streams
    * @param[in] compressed_data Compressed stream data
-   * @param[in,out] stream_out Temporary host output buffer
    * @param[in,out] stripe Stream's parent stripe
    * @param[in,out] streams List of all streams
    * @return An std::future that should be synchronized to ensure the writing is complete
@@ -410,7 +410,6 @@ class writer::impl {
   std::future<void> write_data_stream(gpu::StripeStream const& strm_desc,
                                       gpu::encoder_chunk_streams const& enc_stream,
                                       uint8_t const* compressed_data,
-                                      uint8_t* stream_out,
                                       StripeInformation* stripe,
                                       orc_streams* streams);
 
@@ -452,7 +451,7 @@ class writer::impl {
   persisted_statistics persisted_stripe_statistics;
 
   std::vector<uint8_t> buffer_;
-  std::unique_ptr<data_sink> out_sink_;
+  std::unique_ptr<queued_sink> out_sink_;
 };
 
 }  // namespace orc
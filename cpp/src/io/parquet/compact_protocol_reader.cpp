@@ -18,7 +18,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <string>
 #include <tuple>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -146,6 +148,14 @@ bool CompactProtocolReader::read(FileMetaData* f)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read_deferred(FileMetaData* f)
+{
+  m_defer_column_chunks = true;
+  auto const result     = read(f);
+  m_defer_column_chunks = false;
+  return result;
+}
+
 bool CompactProtocolReader::read(SchemaElement* s)
 {
   auto op = std::make_tuple(ParquetFieldEnum<Type>(1, s->type),
@@ -215,6 +225,13 @@ bool CompactProtocolReader::read(IntType* i)
 
 bool CompactProtocolReader::read(RowGroup* r)
 {
+  if (m_defer_column_chunks) {
+    auto op = std::make_tuple(
+      ParquetFieldStructLocationList<ColumnChunk>(1, r->columns, r->column_locations),
+      ParquetFieldInt64(2, r->total_byte_size),
+      ParquetFieldInt64(3, r->num_rows));
+    return function_builder(this, op);
+  }
   auto op = std::make_tuple(ParquetFieldStructList(1, r->columns),
                             ParquetFieldInt64(2, r->total_byte_size),
                             ParquetFieldInt64(3, r->num_rows));
@@ -281,6 +298,75 @@ bool CompactProtocolReader::read(KeyValue* k)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(Statistics* s)
+{
+  auto op = std::make_tuple(ParquetFieldBinary(1, s->max),
+                            ParquetFieldBinary(2, s->min),
+                            ParquetFieldOptionalInt64(3, s->null_count),
+                            ParquetFieldOptionalInt64(4, s->distinct_count),
+                            ParquetFieldBinary(5, s->max_value),
+                            ParquetFieldBinary(6, s->min_value));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(PageLocation* p)
+{
+  auto op = std::make_tuple(ParquetFieldInt64(1, p->offset),
+                            ParquetFieldInt32(2, p->compressed_page_size),
+                            ParquetFieldInt64(3, p->first_row_index));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(OffsetIndex* o)
+{
+  auto op = std::make_tuple(ParquetFieldStructList(1, o->page_locations));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(ColumnIndex* c)
+{
+  auto op = std::make_tuple(ParquetFieldBoolList(1, c->null_pages),
+                            ParquetFieldBinaryList(2, c->min_values),
+                            ParquetFieldBinaryList(3, c->max_values),
+                            ParquetFieldEnum<BoundaryOrder>(4, c->boundary_order),
+                            ParquetFieldInt64List(5, c->null_counts));
+  return function_builder(this, op);
+}
+
+namespace {
+/**
+ * @brief Finds the schema element of a column from its path in the schema
+ *
+ * @param[in] schema Flattened schema
+ * @param[in] path_in_schema Names of the schema elements from the root to the column
+ * @param[in] start_idx Index of the schema element after which the search starts, and then wraps
+ *
+ * @return Index of the schema element; -1 if not found
+ */
+int find_schema_index(std::vector<SchemaElement> const& schema,
+                      std::vector<std::string> const& path_in_schema,
+                      int start_idx)
+{
+  int schema_idx = -1;
+  int parent     = 0;  // root of schema
+  for (auto const& path : path_in_schema) {
+    auto const it = [&] {
+      // find_if starting at (start_idx + 1) and then wrapping
+      auto element = [&](auto const& e) { return e.parent_idx == parent && e.name == path; };
+      auto mid     = schema.cbegin() + start_idx + 1;
+      auto it      = std::find_if(mid, schema.cend(), element);
+      if (it != schema.cend()) return it;
+      return std::find_if(schema.cbegin(), mid, element);
+    }();
+    if (it == schema.cend()) return -1;
+    start_idx  = std::distance(schema.cbegin(), it);
+    schema_idx = start_idx;
+    parent     = start_idx;
+  }
+  return schema_idx;
+}
+}  // namespace
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -292,36 +378,71 @@ bool CompactProtocolReader::InitSchema(FileMetaData* md)
 {
   if (static_cast<std::size_t>(WalkSchema(md)) != md->schema.size()) return false;
 
+  // Column chunks are stored in the order of the leaves of the schema
+  std::vector<int> leaf_schema_indices;
+  for (size_t i = 1; i < md->schema.size(); ++i) {
+    if (md->schema[i].num_children == 0) { leaf_schema_indices.push_back(i); }
+  }
+
   /* Inside FileMetaData, there is a std::vector of RowGroups and each RowGroup contains a
    * a std::vector of ColumnChunks. Each ColumnChunk has a member ColumnMetaData, which contains
    * a std::vector of std::strings representing paths. The purpose of the code below is to set the
    * schema_idx of each column of each row to it corresponding row_group. This is effectively
-   * mapping the columns to the schema.
+   * mapping the columns to the schema. Columns whose decoding is deferred are mapped by their
+   * position, and checked once decoded.
    */
   for (auto& row_group : md->row_groups) {
     int current_schema_index = 0;
-    for (auto& column : row_group.columns) {
-      int parent = 0;  // root of schema
-      for (auto const& path : column.meta_data.path_in_schema) {
-        auto const it = [&] {
-          // find_if starting at (current_schema_index + 1) and then wrapping
-          auto schema = [&](auto const& e) { return e.parent_idx == parent && e.name == path; };
-          auto mid    = md->schema.cbegin() + current_schema_index + 1;
-          auto it     = std::find_if(mid, md->schema.cend(), schema);
-          if (it != md->schema.cend()) return it;
-          return std::find_if(md->schema.cbegin(), mid, schema);
-        }();
-        if (it == md->schema.cend()) return false;
-        current_schema_index = std::distance(md->schema.cbegin(), it);
-        column.schema_idx    = current_schema_index;
-        parent               = current_schema_index;
+    for (size_t i = 0; i < row_group.columns.size(); ++i) {
+      auto& column = row_group.columns[i];
+      if (i < row_group.column_locations.size() && row_group.column_locations[i].length != 0) {
+        if (i >= leaf_schema_indices.size()) return false;
+        column.schema_idx = leaf_schema_indices[i];
+        continue;
       }
+      if (column.meta_data.path_in_schema.empty()) { continue; }
+      auto const schema_idx =
+        find_schema_index(md->schema, column.meta_data.path_in_schema, current_schema_index);
+      if (schema_idx < 0) return false;
+      current_schema_index = schema_idx;
+      column.schema_idx    = schema_idx;
     }
   }
 
   return true;
 }
 
+/**
+ * @brief Decodes a column chunk that was skipped by `read_deferred`
+ *
+ * @param[in,out] md File metadata that was previously parsed and initialized with `InitSchema`
+ * @param[in] row_group_idx Index of the row group of the column chunk
+ * @param[in] column_idx Index of the column chunk within its row group
+ *
+ * @return True if the column chunk was decoded and mapped to the schema, false otherwise
+ */
+bool CompactProtocolReader::DecodeColumnChunk(FileMetaData* md,
+                                              size_t row_group_idx,
+                                              size_t column_idx)
+{
+  auto& row_group = md->row_groups[row_group_idx];
+  if (column_idx >= row_group.column_locations.size()) return true;
+  auto& location = row_group.column_locations[column_idx];
+  if (location.length == 0) return true;
+  if (location.offset + location.length > static_cast<size_t>(m_end - m_base)) return false;
+
+  auto& column = row_group.columns[column_idx];
+  m_cur        = m_base + location.offset;
+  if (!read(&column)) return false;
+  location.length = 0;
+
+  auto const schema_idx =
+    find_schema_index(md->schema, column.meta_data.path_in_schema, column.schema_idx - 1);
+  if (schema_idx < 0) return false;
+  column.schema_idx = schema_idx;
+  return true;
+}
+
 /**
  * @brief Populates each node in the schema tree
  *
@@ -116,6 +116,23 @@ class CompactProtocolReader {
   bool read(DataPageHeader* d);
   bool read(DictionaryPageHeader* d);
   bool read(KeyValue* k);
+  bool read(Statistics* s);
+  bool read(PageLocation* p);
+  bool read(OffsetIndex* o);
+  bool read(ColumnIndex* c);
+
+  /**
+   * @brief Parses the file metadata, leaving the column chunks of each row group encoded.
+   *
+   * The location of each encoded column chunk is recorded in `RowGroup::column_locations`, so
+   * that only the column chunks that are needed can be decoded later, with
+   * `DecodeColumnChunk`. The reader must then be kept on the same metadata buffer.
+   *
+   * @param[out] f File metadata
+   *
+   * @return True if the metadata was parsed successfully, false otherwise
+   */
+  bool read_deferred(FileMetaData* f);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -123,6 +140,7 @@ class CompactProtocolReader {
     return 32 - CountLeadingZeros32(max_level);
   }
   bool InitSchema(FileMetaData* md);
+  bool DecodeColumnChunk(FileMetaData* md, size_t row_group_idx, size_t column_idx);
 
  protected:
   int WalkSchema(FileMetaData* md,
@@ -136,14 +154,18 @@ class CompactProtocolReader {
   const uint8_t* m_cur  = nullptr;
   const uint8_t* m_end  = nullptr;
 
+  bool m_defer_column_chunks = false;  // Whether to skip decoding of column chunks
+
   friend class ParquetFieldBool;
   friend class ParquetFieldInt8;
   friend class ParquetFieldInt32;
   friend class ParquetFieldOptionalInt32;
   friend class ParquetFieldInt64;
+  friend class ParquetFieldOptionalInt64;
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
+  friend class ParquetFieldBinary;
   template <typename T>
   friend class ParquetFieldStructFunctor;
   template <typename T, bool>
@@ -153,7 +175,12 @@ class CompactProtocolReader {
   template <typename T>
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldBinaryList;
+  friend class ParquetFieldInt64List;
   friend class ParquetFieldStructBlob;
+  template <typename T>
+  friend class ParquetFieldStructLocationList;
 };
 
 /**
@@ -261,6 +288,27 @@ class ParquetFieldInt64 {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to set value to optional 64 bit integer read from CompactProtocolReader
+ *
+ * @return True if field type is not int32 or int64
+ */
+class ParquetFieldOptionalInt64 {
+  int field_val;
+  thrust::optional<int64_t>& val;
+
+ public:
+  ParquetFieldOptionalInt64(int f, thrust::optional<int64_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    val = cpr->get_i64();
+    return (field_type < ST_FLD_I16 || field_type > ST_FLD_I64);
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a vector of structures from CompactProtocolReader
  *
@@ -329,6 +377,35 @@ class ParquetFieldString {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a binary blob from CompactProtocolReader
+ *
+ * @return True if field type mismatches or if size of blob exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinary {
+  int field_val;
+  std::vector<uint8_t>& val;
+
+ public:
+  ParquetFieldBinary(int f, std::vector<uint8_t>& v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_BINARY) return true;
+    uint32_t n = cpr->get_u32();
+    if (n <= (size_t)(cpr->m_end - cpr->m_cur)) {
+      val.assign(cpr->m_cur, cpr->m_cur + n);
+      cpr->m_cur += n;
+      return false;
+    } else {
+      return true;
+    }
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a structure from CompactProtocolReader
  *
@@ -507,6 +584,97 @@ class ParquetFieldStringList {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of bools from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool>& val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    // List elements are encoded as one byte each, with 1 for true
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = (cpr->getb() == ST_FLD_TRUE);
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of binary blobs from CompactProtocolReader
+ *
+ * @return True if field types mismatch or if the size of a blob exceeds bounds
+ * of the CompactProtocolReader
+ */
+class ParquetFieldBinaryList {
+  int field_val;
+  std::vector<std::vector<uint8_t>>& val;
+
+ public:
+  ParquetFieldBinaryList(int f, std::vector<std::vector<uint8_t>>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_BINARY) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      uint32_t l = cpr->get_u32();
+      if (l <= (size_t)(cpr->m_end - cpr->m_cur)) {
+        val[i].assign(cpr->m_cur, cpr->m_cur + l);
+        cpr->m_cur += l;
+      } else
+        return true;
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t>& val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t>& v) : field_val(f), val(v) {}
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      val[i] = cpr->get_i64();
+    }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a struct from CompactProtocolReader
  *
@@ -530,6 +698,48 @@ class ParquetFieldStructBlob {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to record the locations of a list of structs without decoding them
+ *
+ * Each struct of the list is default-constructed.
+ *
+ * @return True if field types mismatch or if a struct can't be skipped
+ */
+template <typename T>
+class ParquetFieldStructLocationList {
+  int field_val;
+  std::vector<T>& val;
+  std::vector<ColumnChunkLocation>& locations;
+
+ public:
+  ParquetFieldStructLocationList(int f, std::vector<T>& v, std::vector<ColumnChunkLocation>& l)
+    : field_val(f), val(v), locations(l)
+  {
+  }
+
+  inline bool operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_STRUCT) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    locations.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      const uint8_t* start = cpr->m_cur;
+      if (!cpr->skip_struct_field(ST_FLD_STRUCT) || cpr->m_cur == start) { return true; }
+      locations[i] = {static_cast<uint32_t>(start - cpr->m_base),
+                      static_cast<uint32_t>(cpr->m_cur - start)};
+    }
+
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 }  // namespace parquet
 }  // namespace io
 }  // namespace cudf
@@ -206,6 +206,20 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing the statistics of a column chunk
+ *
+ * Values are encoded as in the page data, and are empty if not set.
+ */
+struct Statistics {
+  std::vector<uint8_t> max;  // Deprecated maximum value, in signed comparison order
+  std::vector<uint8_t> min;  // Deprecated minimum value, in signed comparison order
+  thrust::optional<int64_t> null_count     = thrust::nullopt;  // Number of null values
+  thrust::optional<int64_t> distinct_count = thrust::nullopt;  // Number of distinct values
+  std::vector<uint8_t> max_value;  // Maximum value, in the sort order of the column type
+  std::vector<uint8_t> min_value;  // Minimum value, in the sort order of the column type
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -247,6 +261,14 @@ struct ColumnChunk {
   int schema_idx = -1;  // Index in flattened schema (derived from path_in_schema)
 };
 
+/**
+ * @brief Location of an encoded ColumnChunk within the file metadata, for deferred decoding
+ */
+struct ColumnChunkLocation {
+  uint32_t offset = 0;  // Offset of the encoded struct from the start of the file metadata
+  uint32_t length = 0;  // Size of the encoded struct; 0 once the struct has been decoded
+};
+
 /**
  * @brief Thrift-derived struct describing a group of row data
  *
@@ -257,6 +279,9 @@ struct RowGroup {
   int64_t total_byte_size = 0;
   std::vector<ColumnChunk> columns;
   int64_t num_rows = 0;
+
+  // Following fields are derived from other fields
+  std::vector<ColumnChunkLocation> column_locations;  // Empty unless column decoding is deferred
 };
 
 /**
@@ -320,6 +345,39 @@ struct PageHeader {
   DictionaryPageHeader dictionary_page_header;
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page in the file
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page, including its header
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the page locations of a column chunk
+ *
+ * Part of the page index, stored outside of the file footer. Only present if the writer chose to
+ * write the page index.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;  // Locations of the data pages, ordered by row index
+};
+
+/**
+ * @brief Thrift-derived struct describing the per-page statistics of a column chunk
+ *
+ * Part of the page index, stored outside of the file footer. Each list holds one entry per data
+ * page, in the same order as the OffsetIndex page locations.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;                  // Whether the page only contains nulls
+  std::vector<std::vector<uint8_t>> min_values;  // Encoded minimum value of each page
+  std::vector<std::vector<uint8_t>> max_values;  // Encoded maximum value of each page
+  BoundaryOrder boundary_order = UNORDERED;      // Ordering of the min/max values
+  std::vector<int64_t> null_counts;              // Optional number of nulls in each page
+};
+
 /**
  * @brief Count the number of leading zeros in an unsigned integer
  */
@@ -120,6 +120,15 @@ enum class PageType : uint8_t {
   DATA_PAGE_V2    = 3,
 };
 
+/**
+ * @brief Ordering of the per-page min/max values in a column index
+ */
+enum BoundaryOrder {
+  UNORDERED  = 0,
+  ASCENDING  = 1,
+  DESCENDING = 2,
+};
+
 /**
  * @brief Thrift compact protocol struct field types
  */
@@ -26,6 +26,8 @@
 #include <io/comp/gpuinflate.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include <io/utilities/time_utils.cuh>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -47,8 +49,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <numeric>
+#include <optional>
 #include <regex>
+#include <variant>
 
 namespace cudf {
 namespace io {
@@ -250,6 +255,223 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Decodes the statistics of a column chunk into the value range of its output column
+ *
+ * Only the values of columns that are read as their natural cudf type, with fixed-width physical
+ * types other than INT96, are decoded.
+ *
+ * @param meta Metadata of the column chunk
+ * @param schema Schema of the column
+ * @param output_type Type of the output column
+ * @param strings_to_categorical Type conversion parameter
+ *
+ * @return Statistics of the column chunk
+ */
+column_block_stats decode_column_chunk_stats(ColumnChunkMetaData const& meta,
+                                             SchemaElement const& schema,
+                                             data_type output_type,
+                                             bool strings_to_categorical)
+{
+  column_block_stats stats{output_type};
+  if (meta.statistics_blob.empty()) { return stats; }
+
+  Statistics chunk_stats;
+  CompactProtocolReader cp(meta.statistics_blob.data(), meta.statistics_blob.size());
+  if (not cp.read(&chunk_stats)) { return stats; }
+  if (chunk_stats.null_count.has_value()) { stats.null_count = chunk_stats.null_count.value(); }
+
+  if (output_type.id() != to_type_id(schema, strings_to_categorical, type_id::EMPTY) ||
+      cudf::is_fixed_point(output_type)) {
+    return stats;
+  }
+
+  // The deprecated min/max values are in signed order, which only matches signed types
+  auto const has_values  = !chunk_stats.min_value.empty() && !chunk_stats.max_value.empty();
+  auto const is_unsigned = cudf::is_unsigned(output_type) && output_type.id() != type_id::BOOL8;
+  if (not has_values && is_unsigned) { return stats; }
+  auto const& min_encoded = has_values ? chunk_stats.min_value : chunk_stats.min;
+  auto const& max_encoded = has_values ? chunk_stats.max_value : chunk_stats.max;
+
+  auto const decode = [&](std::vector<uint8_t> const& value)
+    -> std::optional<column_block_stats::value_type> {
+    auto const read_as = [&](auto type) {
+      decltype(type) v;
+      std::memcpy(&v, value.data(), sizeof(v));
+      return v;
+    };
+    switch (schema.type) {
+      case BOOLEAN:
+        if (value.size() != 1) { break; }
+        return int64_t{value[0] != 0};
+      case INT32:
+        if (value.size() != sizeof(int32_t)) { break; }
+        if (is_unsigned) { return uint64_t{read_as(uint32_t{})}; }
+        return int64_t{read_as(int32_t{})};
+      case INT64:
+        if (value.size() != sizeof(int64_t)) { break; }
+        if (is_unsigned) { return read_as(uint64_t{}); }
+        return read_as(int64_t{});
+      case FLOAT:
+        if (value.size() != sizeof(float)) { break; }
+        return double{read_as(float{})};
+      case DOUBLE:
+        if (value.size() != sizeof(double)) { break; }
+        return read_as(double{});
+      default: break;
+    }
+    return std::nullopt;
+  };
+  stats.min = decode(min_encoded);
+  stats.max = decode(max_encoded);
+  return stats;
+}
+
+/**
+ * @brief Decodes a minimum or maximum value stored in the column index of a page
+ *
+ * @param value Value encoded as in the page data, without length prefix for byte arrays
+ * @param schema Schema of the column
+ *
+ * @return Decoded value; `nullopt` if the type is not supported for page filtering
+ */
+std::optional<parquet_page_filter::value_type> decode_page_index_value(
+  std::vector<uint8_t> const& value, SchemaElement const& schema)
+{
+  auto const logical_converted_type = logical_type_to_converted_type(schema.logical_type);
+  auto const converted_type =
+    (logical_converted_type != parquet::UNKNOWN) ? logical_converted_type : schema.converted_type;
+  if (converted_type == parquet::DECIMAL || converted_type == parquet::INTERVAL) {
+    return std::nullopt;
+  }
+
+  auto const read_as = [&](auto type) {
+    decltype(type) v;
+    std::memcpy(&v, value.data(), sizeof(v));
+    return v;
+  };
+  switch (schema.type) {
+    case BOOLEAN:
+      if (value.size() != 1) { break; }
+      return int64_t{value[0] != 0};
+    case INT32:
+      if (value.size() != sizeof(int32_t)) { break; }
+      if (converted_type == parquet::UINT_8 || converted_type == parquet::UINT_16 ||
+          converted_type == parquet::UINT_32) {
+        return int64_t{read_as(uint32_t{})};
+      }
+      return int64_t{read_as(int32_t{})};
+    case INT64:
+      // Unsigned 64-bit values do not fit the signed bounds
+      if (value.size() != sizeof(int64_t) || converted_type == parquet::UINT_64) { break; }
+      return read_as(int64_t{});
+    case FLOAT:
+      if (value.size() != sizeof(float)) { break; }
+      return double{read_as(float{})};
+    case DOUBLE:
+      if (value.size() != sizeof(double)) { break; }
+      return read_as(double{});
+    case BYTE_ARRAY:
+    case FIXED_LEN_BYTE_ARRAY: return std::string(value.cbegin(), value.cend());
+    default: break;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Returns whether a page may hold values within the range of the page filter
+ *
+ * @param index Column index of the column chunk
+ * @param page Index of the page within the column chunk
+ * @param schema Schema of the column
+ * @param filter Page filter
+ */
+bool page_may_pass_filter(ColumnIndex const& index,
+                          size_t page,
+                          SchemaElement const& schema,
+                          parquet_page_filter const& filter)
+{
+  // Pages that only hold nulls never hold a value within the range
+  if (index.null_pages[page]) { return false; }
+
+  auto const page_min = decode_page_index_value(index.min_values[page], schema);
+  auto const page_max = decode_page_index_value(index.max_values[page], schema);
+  if (!page_min.has_value() || !page_max.has_value()) { return true; }
+
+  auto const is_less = [](auto const& lhs, auto const& rhs) {
+    CUDF_EXPECTS(lhs.index() == rhs.index(),
+                 "Page filter bounds do not match the type of the column");
+    return lhs < rhs;
+  };
+  if (filter.max.has_value() && is_less(*filter.max, *page_min)) { return false; }
+  if (filter.min.has_value() && is_less(*page_max, *filter.min)) { return false; }
+  return true;
+}
+
+/**
+ * @brief Returns whether the page locations of a column chunk are consistent with the chunk
+ *
+ * @param locations Page locations from the offset index of the chunk
+ * @param chunk_offset File offset of the chunk
+ * @param chunk_size Size of the chunk in bytes
+ * @param num_rows Number of rows in the row group
+ */
+bool is_valid_page_index(std::vector<PageLocation> const& locations,
+                         size_t chunk_offset,
+                         size_t chunk_size,
+                         int64_t num_rows)
+{
+  if (locations.empty() || locations.front().first_row_index != 0) { return false; }
+  auto prev_end = static_cast<int64_t>(chunk_offset);
+  auto prev_row = int64_t{-1};
+  for (auto const& location : locations) {
+    if (location.offset < prev_end || location.compressed_page_size <= 0 ||
+        location.first_row_index <= prev_row || location.first_row_index >= num_rows) {
+      return false;
+    }
+    prev_end = location.offset + location.compressed_page_size;
+    prev_row = location.first_row_index;
+  }
+  return prev_end <= static_cast<int64_t>(chunk_offset + chunk_size);
+}
+
+/**
+ * @brief Selects the data pages of a column chunk that hold a range of rows
+ *
+ * @param locations Page locations from the offset index of the chunk
+ * @param chunk_offset File offset of the chunk
+ * @param chunk_size Size of the chunk in bytes
+ * @param num_rows Number of rows in the row group
+ * @param first_row First row to read, relative to the row group
+ * @param end_row One past the last row to read, relative to the row group
+ *
+ * @return Index of the first page and one past the last page to read; `nullopt` if all pages are
+ * read or if the page locations do not match the chunk
+ */
+std::optional<std::pair<size_t, size_t>> select_chunk_pages(
+  std::vector<PageLocation> const& locations,
+  size_t chunk_offset,
+  size_t chunk_size,
+  int64_t num_rows,
+  int64_t first_row,
+  int64_t end_row)
+{
+  if (not is_valid_page_index(locations, chunk_offset, chunk_size, num_rows)) {
+    return std::nullopt;
+  }
+
+  size_t begin = 0;
+  while (begin + 1 < locations.size() && locations[begin + 1].first_row_index <= first_row) {
+    ++begin;
+  }
+  size_t end = begin + 1;
+  while (end < locations.size() && locations[end].first_row_index < end_row) {
+    ++end;
+  }
+  if (begin == 0 && end == locations.size()) { return std::nullopt; }
+  return std::pair{begin, end};
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string>& path_in_schema)
@@ -289,12 +511,56 @@ std::string name_from_path(const std::vector<std::string>& path_in_schema)
   return s;
 }
 
+/**
+ * @brief Returns an estimate of the host memory used by decoded file metadata, in bytes
+ *
+ * Decoded metadata is several times larger than its encoding, so this is the size charged to the
+ * metadata cache.
+ */
+std::size_t decoded_size(FileMetaData const& md)
+{
+  auto size = sizeof(md) + md.created_by.size();
+  for (auto const& schema : md.schema) {
+    size += sizeof(schema) + schema.name.size() + schema.children_idx.size() * sizeof(size_t);
+  }
+  for (auto const& row_group : md.row_groups) {
+    size += sizeof(row_group) + row_group.column_locations.size() * sizeof(ColumnChunkLocation);
+    for (auto const& chunk : row_group.columns) {
+      auto const& meta = chunk.meta_data;
+      size += sizeof(chunk) + chunk.file_path.size() + meta.encodings.size() * sizeof(Encoding) +
+              meta.statistics_blob.size();
+      for (auto const& path : meta.path_in_schema) {
+        size += sizeof(path) + path.size();
+      }
+    }
+  }
+  for (auto const& kv : md.key_value_metadata) {
+    size += sizeof(kv) + kv.key.size() + kv.value.size();
+  }
+  return size;
+}
+
 /**
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource* source)
+  /**
+   * @brief Reads and parses the metadata of a source.
+   *
+   * @param source Dataset source
+   * @param defer_column_chunks Whether to leave the column chunks encoded until they are needed;
+   * ignored if the metadata is cached, as cached metadata is shared by all reads
+   */
+  explicit metadata(datasource* source, bool defer_column_chunks)
   {
+    auto& cache          = cudf::io::detail::metadata_cache::instance();
+    auto const cache_key = cache.make_key(*source, "parquet");
+    if (auto const cached = cache.find<FileMetaData>(cache_key); cached != nullptr) {
+      static_cast<FileMetaData&>(*this) = *cached;
+      return;
+    }
+    defer_column_chunks = defer_column_chunks && cache_key.empty();
+
     constexpr auto header_len = sizeof(file_header_s);
     constexpr auto ender_len  = sizeof(file_ender_s);
 
@@ -309,11 +575,53 @@ struct metadata : public FileMetaData {
     CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
                  "Incorrect footer length");
 
-    const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
+    auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    CUDF_EXPECTS(defer_column_chunks ? cp.read_deferred(this) : cp.read(this),
+                 "Cannot parse metadata");
     CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+
+    if (defer_column_chunks) {
+      // Keep the encoded metadata to decode the column chunks later
+      footer = std::move(buffer);
+    } else {
+      cache.insert(cache_key,
+                   std::make_shared<FileMetaData const>(static_cast<FileMetaData const&>(*this)),
+                   decoded_size(*this));
+    }
   }
+
+  /**
+   * @brief Decodes the deferred column chunks of a row group that map to the given schema leaves.
+   *
+   * If a decoded column chunk is not at the position of its leaf in the schema, all column chunks
+   * of the row group are decoded.
+   */
+  void decode_column_chunks(size_type row_group_idx, std::vector<int> const& schema_indices)
+  {
+    if (footer == nullptr) { return; }
+
+    CompactProtocolReader cp(footer->data(), footer->size());
+    auto& row_group      = row_groups[row_group_idx];
+    bool is_out_of_order = false;
+    for (size_t i = 0; i < row_group.columns.size(); ++i) {
+      auto const assumed_idx = row_group.columns[i].schema_idx;
+      if (std::find(schema_indices.cbegin(), schema_indices.cend(), assumed_idx) ==
+          schema_indices.cend()) {
+        continue;
+      }
+      CUDF_EXPECTS(cp.DecodeColumnChunk(this, row_group_idx, i), "Cannot parse column metadata");
+      is_out_of_order |= row_group.columns[i].schema_idx != assumed_idx;
+    }
+    if (is_out_of_order) {
+      for (size_t i = 0; i < row_group.columns.size(); ++i) {
+        CUDF_EXPECTS(cp.DecodeColumnChunk(this, row_group_idx, i), "Cannot parse column metadata");
+      }
+    }
+  }
+
+  // Encoded metadata, kept while some column chunks are not decoded
+  std::unique_ptr<datasource::buffer> footer;
 };
 
 class aggregate_reader_metadata {
@@ -324,13 +632,16 @@ class aggregate_reader_metadata {
   /**
    * @brief Create a metadata object from each element in the source vector
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                              bool defer_column_chunks)
   {
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    std::transform(sources.cbegin(),
+                   sources.cend(),
+                   std::back_inserter(metadatas),
+                   [defer_column_chunks](auto const& source) {
+                     return metadata(source.get(), defer_column_chunks);
+                   });
     return metadatas;
   }
 
@@ -380,8 +691,9 @@ class aggregate_reader_metadata {
   }
 
  public:
-  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                            bool defer_column_chunks)
+    : per_file_metadata(metadatas_from_sources(sources, defer_column_chunks)),
       keyval_maps(collect_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -411,17 +723,40 @@ class aggregate_reader_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
+  [[nodiscard]] auto const& get_column_chunk(size_type row_group_index,
+                                             size_type src_idx,
+                                             int schema_idx) const
+  {
+    auto const& row_group = per_file_metadata[src_idx].row_groups[row_group_index];
+    auto col              = std::find_if(
+      row_group.columns.begin(), row_group.columns.end(), [schema_idx](ColumnChunk const& col) {
+        return col.schema_idx == schema_idx ? true : false;
+      });
+    CUDF_EXPECTS(col != std::end(row_group.columns), "Found no metadata for schema index");
+    auto const col_idx = std::distance(row_group.columns.begin(), col);
+    CUDF_EXPECTS(static_cast<size_t>(col_idx) >= row_group.column_locations.size() or
+                   row_group.column_locations[col_idx].length == 0,
+                 "Column chunk metadata has not been decoded");
+    return *col;
+  }
+
+  /**
+   * @brief Decodes the column chunk metadata of the given row groups and schema leaves, for
+   * sources whose column chunk decoding was deferred.
+   */
+  void decode_column_chunks(std::vector<row_group_info> const& row_groups,
+                            std::vector<int> const& schema_indices)
+  {
+    for (auto const& rg : row_groups) {
+      per_file_metadata[rg.source_index].decode_column_chunks(rg.index, schema_indices);
+    }
+  }
+
   [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
                                                 size_type src_idx,
                                                 int schema_idx) const
   {
-    auto col = std::find_if(
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
-      per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
-      [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
-    CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
-                 "Found no metadata for schema index");
-    return col->meta_data;
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
@@ -435,6 +770,32 @@ class aggregate_reader_metadata {
 
   [[nodiscard]] auto const& get_key_value_metadata() const { return keyval_maps; }
 
+  /**
+   * @brief Finds the schema index of a leaf column from its path
+   *
+   * @param path Names of the column and its parents, joined by '.'
+   *
+   * @return Schema index of the column; -1 if there is no leaf column with this path
+   */
+  [[nodiscard]] int find_leaf_schema_index(std::string const& path) const
+  {
+    int schema_idx = 0;
+    size_t pos     = 0;
+    while (pos <= path.size()) {
+      auto const end     = std::min(path.find('.', pos), path.size());
+      auto const name    = path.substr(pos, end - pos);
+      auto const& parent = get_schema(schema_idx);
+      auto const child   = std::find_if(
+        parent.children_idx.cbegin(), parent.children_idx.cend(), [&](size_t child_idx) {
+          return get_schema(child_idx).name == name;
+        });
+      if (child == parent.children_idx.cend()) { return -1; }
+      schema_idx = static_cast<int>(*child);
+      pos        = end + 1;
+    }
+    return get_schema(schema_idx).num_children == 0 ? schema_idx : -1;
+  }
+
   /**
    * @brief Gets the concrete nesting depth of output cudf columns
    *
@@ -520,16 +881,6 @@ class aggregate_reader_metadata {
     return names;
   }
 
-  struct row_group_info {
-    size_type const index;
-    size_t const start_row;  // TODO source index
-    size_type const source_index;
-    row_group_info(size_type index, size_t start_row, size_type source_index)
-      : index(index), start_row(start_row), source_index(source_index)
-    {
-    }
-  };
-
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -973,21 +1324,26 @@ std::future<void> reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t>& column_chunk_offsets,
+  std::vector<std::optional<chunk_subrange>> const& chunk_subranges,
   std::vector<size_type> const& chunk_source_map,
   rmm::cuda_stream_view stream)
 {
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
+  // Host reads are issued together per source, so that sources can merge and parallelize them
+  std::vector<std::vector<datasource::read_range>> host_ranges(_sources.size());
+  std::vector<std::vector<uint8_t*>> host_dsts(_sources.size());
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+    while (next_chunk < end_chunk && not chunk_subranges[chunk].has_value()) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          chunk_subranges[next_chunk].has_value()) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -997,18 +1353,28 @@ std::future<void> reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
+      // Partially read chunks are assembled from the chunk prefix and the selected data pages
+      std::vector<std::pair<size_t, size_t>> io_ranges{{io_offset, io_size}};
+      if (auto const& subrange = chunk_subranges[chunk]; subrange.has_value()) {
+        io_ranges = {{io_offset, subrange->prefix_size},
+                     {subrange->data_offset, io_size - subrange->prefix_size}};
+      }
+
       auto& source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        auto buffer        = rmm::device_buffer(io_size, stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
-        page_data[chunk] = datasource::buffer::create(std::move(buffer));
-      } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+      auto buffer  = rmm::device_buffer(io_size, stream);
+      auto d_dst   = static_cast<uint8_t*>(buffer.data());
+      for (auto const& [offset, size] : io_ranges) {
+        if (size == 0) { continue; }
+        if (source->is_device_read_preferred(size)) {
+          read_tasks.emplace_back(source->device_read_async(offset, size, d_dst, stream));
+        } else {
+          host_ranges[chunk_source_map[chunk]].push_back({offset, size});
+          host_dsts[chunk_source_map[chunk]].push_back(d_dst);
+        }
+        d_dst += size;
       }
+      page_data[chunk] = datasource::buffer::create(std::move(buffer));
+
       auto d_compdata = page_data[chunk]->data();
       do {
         chunks[chunk].compressed_data = d_compdata;
@@ -1018,6 +1384,17 @@ std::future<void> reader::impl::read_column_chunks(
       chunk = next_chunk;
     }
   }
+  for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    if (host_ranges[src_idx].empty()) { continue; }
+    auto const host_buffers = _sources[src_idx]->host_read_ranges(host_ranges[src_idx]);
+    for (size_t i = 0; i < host_buffers.size(); ++i) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(host_dsts[src_idx][i],
+                                    host_buffers[i]->data(),
+                                    host_buffers[i]->size(),
+                                    cudaMemcpyHostToDevice,
+                                    stream.value()));
+    }
+  }
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
       task.wait();
@@ -1026,6 +1403,230 @@ std::future<void> reader::impl::read_column_chunks(
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::load_page_index
+ */
+void reader::impl::load_page_index(std::vector<row_group_info> const& row_groups,
+                                   std::vector<int> const& schema_indices,
+                                   bool with_column_index)
+{
+  struct index_location {
+    std::tuple<size_type, size_type, int> key;
+    int64_t offset;
+    int32_t length;
+    bool is_column_index;
+  };
+  std::map<size_type, std::vector<index_location>> source_locations;
+  for (auto const& rg : row_groups) {
+    for (auto const schema_idx : schema_indices) {
+      auto const key    = std::make_tuple(rg.source_index, rg.index, schema_idx);
+      auto const& chunk = _metadata->get_column_chunk(rg.index, rg.source_index, schema_idx);
+      if (chunk.offset_index_offset > 0 && chunk.offset_index_length > 0 &&
+          _offset_indexes.count(key) == 0) {
+        source_locations[rg.source_index].push_back(
+          {key, chunk.offset_index_offset, chunk.offset_index_length, false});
+      }
+      if (with_column_index && chunk.column_index_offset > 0 && chunk.column_index_length > 0 &&
+          _column_indexes.count(key) == 0) {
+        source_locations[rg.source_index].push_back(
+          {key, chunk.column_index_offset, chunk.column_index_length, true});
+      }
+    }
+  }
+
+  // The page index of all column chunks is stored together ahead of the footer, so a single read
+  // per source covers all the requested chunks
+  for (auto const& [source_idx, locations] : source_locations) {
+    auto const& source = _sources[source_idx];
+    auto begin         = std::numeric_limits<int64_t>::max();
+    auto end           = int64_t{0};
+    for (auto const& location : locations) {
+      begin = std::min(begin, location.offset);
+      end   = std::max(end, location.offset + location.length);
+    }
+    end = std::min<int64_t>(end, source->size());
+    if (begin >= end) { continue; }
+
+    auto const buffer = source->host_read(begin, end - begin);
+    for (auto const& location : locations) {
+      if (location.offset + location.length > begin + static_cast<int64_t>(buffer->size())) {
+        continue;
+      }
+      CompactProtocolReader cp(buffer->data() + (location.offset - begin), location.length);
+      if (location.is_column_index) {
+        ColumnIndex column_index;
+        if (cp.read(&column_index)) { _column_indexes.emplace(location.key, column_index); }
+      } else {
+        OffsetIndex offset_index;
+        if (cp.read(&offset_index)) { _offset_indexes.emplace(location.key, offset_index); }
+      }
+    }
+  }
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::index_page_headers
+ */
+void reader::impl::index_page_headers(std::vector<row_group_info> const& row_groups,
+                                      std::vector<int> const& schema_indices)
+{
+  // Page headers have no length prefix, so a window that is grown until it holds the whole header
+  // is read for each page
+  constexpr size_t initial_header_window = 256;
+
+  for (auto const& rg : row_groups) {
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    for (auto const schema_idx : schema_indices) {
+      auto const key = std::make_tuple(rg.source_index, rg.index, schema_idx);
+      if (_offset_indexes.count(key) != 0) { continue; }
+
+      auto const& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+      auto const chunk_offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      auto const chunk_end = chunk_offset + col_meta.total_compressed_size;
+      auto const& source   = _sources[rg.source_index];
+
+      OffsetIndex offset_index;
+      int64_t first_row = 0;
+      bool is_valid     = true;
+      for (auto page_offset = chunk_offset; is_valid && page_offset < chunk_end;) {
+        auto const max_window = static_cast<size_t>(chunk_end - page_offset);
+        PageHeader header;
+        size_t header_size = 0;
+        for (auto window = std::min(initial_header_window, max_window);; window *= 4) {
+          window            = std::min(window, max_window);
+          auto const buffer = source->host_read(page_offset, window);
+          CompactProtocolReader cp(buffer->data(), buffer->size());
+          header = PageHeader{};
+          // A truncated header may parse, so the header must end within the window
+          if (cp.read(&header) && static_cast<size_t>(cp.bytecount()) < buffer->size()) {
+            header_size = cp.bytecount();
+            break;
+          }
+          if (window == max_window || buffer->size() < window) { break; }
+        }
+
+        auto const page_size = static_cast<int64_t>(header_size) + header.compressed_page_size;
+        if (header_size == 0 || header.compressed_page_size < 0 ||
+            page_offset + page_size > chunk_end) {
+          is_valid = false;
+        } else if (header.type == PageType::DATA_PAGE && header.data_page_header.num_values > 0) {
+          offset_index.page_locations.push_back(
+            {page_offset, static_cast<int32_t>(page_size), first_row});
+          first_row += header.data_page_header.num_values;
+        } else if (header.type != PageType::DICTIONARY_PAGE) {
+          // The row count of version 2 data pages is not parsed on the host
+          is_valid = false;
+        }
+        page_offset += page_size;
+      }
+
+      // Values only match rows in flat columns
+      if (is_valid && first_row == rg_rows) { _offset_indexes.emplace(key, offset_index); }
+    }
+  }
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::apply_page_filter
+ */
+std::vector<row_group_info> reader::impl::apply_page_filter(
+  std::vector<row_group_info> const& row_groups, size_type& skip_rows, size_type& num_rows)
+{
+  auto const& filter    = _page_filter.value();
+  auto const schema_idx = _metadata->find_leaf_schema_index(filter.column);
+  CUDF_EXPECTS(schema_idx >= 0, "Page filter column not found: " + filter.column);
+  auto const& schema = _metadata->get_schema(schema_idx);
+
+  load_page_index(row_groups, {schema_idx}, true);
+
+  std::vector<row_group_info> selection;
+  size_t selection_rows = 0;
+  std::optional<size_t> first_row;
+  size_t end_row = 0;
+  for (auto const& rg : row_groups) {
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+
+    // Rows of the row group held by pages that may pass the filter; all rows if the chunk has no
+    // usable page index
+    auto const [rows_begin, rows_end] = [&]() -> std::pair<int64_t, int64_t> {
+      auto const key          = std::make_tuple(rg.source_index, rg.index, schema_idx);
+      auto const offset_index = _offset_indexes.find(key);
+      auto const column_index = _column_indexes.find(key);
+      if (offset_index == _offset_indexes.end() || column_index == _column_indexes.end()) {
+        return {0, rg_rows};
+      }
+      auto const& locations = offset_index->second.page_locations;
+      auto const& index     = column_index->second;
+      auto const num_pages  = locations.size();
+      if (num_pages == 0 || index.null_pages.size() != num_pages ||
+          index.min_values.size() != num_pages || index.max_values.size() != num_pages) {
+        return {0, rg_rows};
+      }
+
+      int64_t begin = rg_rows;
+      int64_t end   = 0;
+      for (size_t page = 0; page < num_pages; ++page) {
+        if (not page_may_pass_filter(index, page, schema, filter)) { continue; }
+        begin = std::min(begin, locations[page].first_row_index);
+        end   = std::max(end, page + 1 < num_pages ? locations[page + 1].first_row_index : rg_rows);
+      }
+      return {begin, end};
+    }();
+    if (rows_begin >= rows_end) { continue; }
+
+    if (not first_row.has_value()) { first_row = selection_rows + rows_begin; }
+    end_row = selection_rows + rows_end;
+    selection.emplace_back(rg.index, selection_rows, rg.source_index);
+    selection_rows += rg_rows;
+  }
+
+  skip_rows = first_row.value_or(0);
+  num_rows  = end_row - skip_rows;
+  return selection;
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::apply_stats_filter
+ */
+std::vector<row_group_info> reader::impl::apply_stats_filter(
+  std::vector<row_group_info> const& row_groups,
+  size_type& skip_rows,
+  size_type& num_rows,
+  rmm::cuda_stream_view stream)
+{
+  stats_filter const filter(_filter.value().get(), stream);
+
+  std::vector<row_group_info> selection;
+  std::vector<column_block_stats> columns_stats(_output_columns.size());
+  size_t selection_rows = 0;
+  for (auto const& rg : row_groups) {
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+
+    // Only leaf columns at the top level of the schema have chunk statistics
+    for (size_t i = 0; i < _output_columns.size(); ++i) {
+      auto const schema_idx = _output_column_schemas[i];
+      auto const& schema    = _metadata->get_schema(schema_idx);
+      auto const type       = _output_columns[i].type;
+      columns_stats[i]      = column_block_stats{type};
+      if (schema.num_children == 0) {
+        auto const& meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+        columns_stats[i] = decode_column_chunk_stats(meta, schema, type, _strings_to_categorical);
+      }
+    }
+    if (not filter.may_contain_matches(columns_stats, rg_rows)) { continue; }
+
+    selection.emplace_back(rg.index, selection_rows, rg.source_index);
+    selection_rows += rg_rows;
+  }
+
+  skip_rows = 0;
+  num_rows  = selection_rows;
+  return selection;
+}
+
 /**
  * @copydoc cudf::io::detail::parquet::count_page_headers
  */
@@ -1576,8 +2177,10 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                    rmm::mr::device_memory_resource* mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
+  // Open and parse the source dataset metadata. When only some columns are read, the metadata of
+  // the column chunks is decoded once the columns and row groups to read are known.
+  _metadata =
+    std::make_unique<aggregate_reader_metadata>(_sources, options.get_columns().has_value());
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1587,6 +2190,9 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  _page_filter = options.get_page_filter();
+  _filter      = options.get_filter();
+
   // Select only columns required by the options
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
     _metadata->select_columns(options.get_columns(),
@@ -1600,9 +2206,23 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                        std::vector<std::vector<size_type>> const& row_group_list,
                                        rmm::cuda_stream_view stream)
 {
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+  // Select only row groups required, and narrow them down further with the page index
+  const auto selected_row_groups = [&]() {
+    auto const selection = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+    std::vector<int> schema_indices;
+    std::transform(_input_columns.cbegin(),
+                   _input_columns.cend(),
+                   std::back_inserter(schema_indices),
+                   [](auto const& col) { return col.schema_idx; });
+    if (_page_filter.has_value()) {
+      schema_indices.push_back(_metadata->find_leaf_schema_index(_page_filter->column));
+    }
+    _metadata->decode_column_chunks(selection, schema_indices);
+    auto const filtered  = _filter.has_value()
+                             ? apply_stats_filter(selection, skip_rows, num_rows, stream)
+                             : selection;
+    return _page_filter.has_value() ? apply_page_filter(filtered, skip_rows, num_rows) : filtered;
+  }();
 
   table_metadata out_metadata;
 
@@ -1624,9 +2244,42 @@ table_with_metadata reader::impl::read(size_type skip_rows,
 
     // Keep track of column chunk file offsets
     std::vector<size_t> column_chunk_offsets(num_chunks);
+    std::vector<std::optional<chunk_subrange>> chunk_subranges(num_chunks);
 
     // if there are lists present, we need to preprocess
-    bool has_lists = false;
+    bool const has_lists =
+      std::any_of(_input_columns.cbegin(), _input_columns.cend(), [&](auto const& col) {
+        return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+      });
+
+    // Rows to read from a row group, relative to the start of the selection
+    auto const rows_to_read = [&](row_group_info const& rg) {
+      auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      return std::pair{std::max<size_t>(skip_rows, rg.start_row),
+                       std::min<size_t>(skip_rows + num_rows, rg.start_row + rg_rows)};
+    };
+
+    // For flat schemas, only the data pages that hold the rows to read are read from row groups
+    // that are partially read, using the offset index of the chunks when it is present
+    auto const is_partially_read = [&](row_group_info const& rg) {
+      if (has_lists) { return false; }
+      auto const [first_row, end_row] = rows_to_read(rg);
+      auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      return first_row < end_row && (first_row > rg.start_row || end_row < rg.start_row + rg_rows);
+    };
+    std::vector<row_group_info> partial_row_groups;
+    std::copy_if(selected_row_groups.cbegin(),
+                 selected_row_groups.cend(),
+                 std::back_inserter(partial_row_groups),
+                 is_partially_read);
+    if (not partial_row_groups.empty()) {
+      std::vector<int> schema_indices;
+      std::transform(_input_columns.cbegin(),
+                     _input_columns.cend(),
+                     std::back_inserter(schema_indices),
+                     [](auto const& col) { return col.schema_idx; });
+      load_page_index(partial_row_groups, schema_indices, false);
+    }
 
     // Initialize column chunk information
     size_t total_decompressed_size = 0;
@@ -1639,6 +2292,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
       auto const io_chunk_idx     = chunks.size();
 
+      auto const [first_row, end_row] = rows_to_read(rg);
+      auto const is_partial           = is_partially_read(rg);
+
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
         auto col = _input_columns[i];
@@ -1646,9 +2302,6 @@ table_with_metadata reader::impl::read(size_type skip_rows,
         auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
         auto& schema   = _metadata->get_schema(col.schema_idx);
 
-        // this column contains repetition levels and will require a preprocess
-        if (schema.max_repetition_level > 0) { has_lists = true; }
-
         // Spec requires each row group to contain exactly one chunk for every
         // column. If there are too many or too few, continue with best effort
         if (chunks.size() >= chunks.max_size()) {
@@ -1663,17 +2316,43 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                           schema.converted_type,
                           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        auto const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        column_chunk_offsets[chunks.size()] = chunk_offset;
+
+        // Skip the data pages that hold none of the rows to read
+        size_t chunk_size      = col_meta.total_compressed_size;
+        size_t chunk_start_row = row_group_start;
+        auto const offset_index =
+          _offset_indexes.find(std::make_tuple(rg.source_index, rg.index, col.schema_idx));
+        if (is_partial && offset_index != _offset_indexes.end()) {
+          auto const& locations = offset_index->second.page_locations;
+          auto const pages      = select_chunk_pages(locations,
+                                                     chunk_offset,
+                                                     chunk_size,
+                                                     row_group.num_rows,
+                                                     first_row - row_group_start,
+                                                     end_row - row_group_start);
+          if (pages.has_value()) {
+            auto const& first_page = locations[pages->first];
+            auto const& last_page  = locations[pages->second - 1];
+            auto const prefix_size = static_cast<size_t>(locations.front().offset) - chunk_offset;
+            chunk_subranges[chunks.size()] =
+              chunk_subrange{prefix_size, static_cast<size_t>(first_page.offset)};
+            chunk_size = prefix_size + (last_page.offset + last_page.compressed_page_size -
+                                        first_page.offset);
+            chunk_start_row = row_group_start + first_page.first_row_index;
+          }
+        }
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
                                            col_meta.num_values,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
+                                           chunk_start_row,
                                            row_group_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
@@ -1701,6 +2380,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
                                                        io_chunk_idx,
                                                        chunks.size(),
                                                        column_chunk_offsets,
+                                                       chunk_subranges,
                                                        chunk_source_map,
                                                        stream));
 
@@ -1790,6 +2470,214 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+/**
+ * @copydoc cudf::io::detail::parquet::setup_chunks
+ */
+void reader::impl::setup_chunks(parquet_reader_options const& options,
+                                size_t chunk_read_limit,
+                                size_t pass_read_limit)
+{
+  auto skip_rows             = options.get_skip_rows();
+  auto num_rows              = options.get_num_rows();
+  auto const& row_group_list = options.get_row_groups();
+  auto const selection       = _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
+
+  std::vector<int> schema_indices;
+  std::transform(_input_columns.cbegin(),
+                 _input_columns.cend(),
+                 std::back_inserter(schema_indices),
+                 [](auto const& col) { return col.schema_idx; });
+  _metadata->decode_column_chunks(selection, schema_indices);
+
+  // The filters select rows per row group, so with a filter, as with a list of row groups, the
+  // chunks are made of whole row groups. Otherwise the chunks are ranges of rows, and the row
+  // groups of flat schemas are split at page boundaries.
+  bool const by_row_groups =
+    not row_group_list.empty() || _filter.has_value() || _page_filter.has_value();
+  bool const has_lists =
+    std::any_of(_input_columns.cbegin(), _input_columns.cend(), [&](auto const& col) {
+      return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+    });
+
+  auto const exceeds_limits = [&](double output_size, double pass_size) {
+    return (chunk_read_limit > 0 && output_size > static_cast<double>(chunk_read_limit)) ||
+           (pass_read_limit > 0 && pass_size > static_cast<double>(pass_read_limit));
+  };
+
+  // Smallest ranges of rows that can be read on their own. The estimated device memory needed to
+  // read a range is its output size, plus its compressed and decompressed page data, plus the
+  // dictionary pages of its row group if the chunk does not read another range of it.
+  struct segment {
+    row_group_info const* rg;
+    size_t first_row;
+    size_t end_row;
+    double output_size;
+    double pass_size;
+    double dictionary_size;
+  };
+  std::vector<segment> segments;
+  for (auto const& rg : selection) {
+    auto const rg_rows   = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    auto const rg_end    = rg.start_row + rg_rows;
+    auto const first_row = by_row_groups ? rg.start_row : std::max<size_t>(skip_rows, rg.start_row);
+    auto const end_row   = by_row_groups ? rg_end : std::min<size_t>(skip_rows + num_rows, rg_end);
+    if (first_row >= end_row) { continue; }
+
+    double output_size = 0;
+    double pass_size   = 0;
+    for (auto const schema_idx : schema_indices) {
+      auto const& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+      output_size += col_meta.total_uncompressed_size;
+      pass_size += col_meta.total_compressed_size + col_meta.total_uncompressed_size +
+                   (col_meta.codec != UNCOMPRESSED ? col_meta.total_uncompressed_size : 0);
+    }
+    auto const fraction = static_cast<double>(end_row - first_row) / rg_rows;
+    if (by_row_groups || has_lists ||
+        not exceeds_limits(output_size * fraction, pass_size * fraction)) {
+      segments.push_back(
+        {&rg, first_row, end_row, output_size * fraction, pass_size * fraction, 0});
+      continue;
+    }
+
+    // Split the row group at the page boundaries of all its column chunks
+    load_page_index({rg}, schema_indices, false);
+    index_page_headers({rg}, schema_indices);
+    auto const rg_first_row = static_cast<int64_t>(first_row - rg.start_row);
+    auto const rg_end_row   = static_cast<int64_t>(end_row - rg.start_row);
+    std::vector<int64_t> boundaries{rg_first_row, rg_end_row};
+    bool is_indexed = true;
+    for (auto const schema_idx : schema_indices) {
+      auto const& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+      auto const chunk_offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      auto const offset_index =
+        _offset_indexes.find(std::make_tuple(rg.source_index, rg.index, schema_idx));
+      if (offset_index == _offset_indexes.end() ||
+          not is_valid_page_index(offset_index->second.page_locations,
+                                  chunk_offset,
+                                  col_meta.total_compressed_size,
+                                  rg_rows)) {
+        is_indexed = false;
+        break;
+      }
+      for (auto const& location : offset_index->second.page_locations) {
+        if (location.first_row_index > rg_first_row && location.first_row_index < rg_end_row) {
+          boundaries.push_back(location.first_row_index);
+        }
+      }
+    }
+    if (not is_indexed) {
+      segments.push_back(
+        {&rg, first_row, end_row, output_size * fraction, pass_size * fraction, 0});
+      continue;
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+    auto const rg_segments = segments.size();
+    for (size_t i = 0; i + 1 < boundaries.size(); ++i) {
+      segments.push_back(
+        {&rg, rg.start_row + boundaries[i], rg.start_row + boundaries[i + 1], 0, 0, 0});
+    }
+    // Pages that span several segments are attributed to them in proportion of their rows
+    for (auto const schema_idx : schema_indices) {
+      auto const& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+      auto const& locations =
+        _offset_indexes.at(std::make_tuple(rg.source_index, rg.index, schema_idx)).page_locations;
+      auto const chunk_offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      auto const is_compressed = col_meta.codec != UNCOMPRESSED;
+      auto const ratio         = static_cast<double>(col_meta.total_uncompressed_size) /
+                         std::max<int64_t>(col_meta.total_compressed_size, 1);
+      auto const page_end_row = [&](size_t page) {
+        return page + 1 < locations.size() ? locations[page + 1].first_row_index
+                                           : static_cast<int64_t>(rg_rows);
+      };
+      auto const dictionary_size = static_cast<double>(locations.front().offset - chunk_offset);
+      segments[rg_segments].dictionary_size += dictionary_size * (1 + (is_compressed ? ratio : 0));
+
+      size_t page = 0;
+      for (size_t i = rg_segments; i < segments.size(); ++i) {
+        auto const begin = static_cast<int64_t>(segments[i].first_row - rg.start_row);
+        auto const end   = static_cast<int64_t>(segments[i].end_row - rg.start_row);
+        while (page_end_row(page) <= begin) {
+          ++page;
+        }
+        for (auto p = page; p < locations.size() && locations[p].first_row_index < end; ++p) {
+          auto const page_rows = page_end_row(p) - locations[p].first_row_index;
+          auto const overlap =
+            std::min(end, page_end_row(p)) - std::max(begin, locations[p].first_row_index);
+          auto const page_size =
+            static_cast<double>(locations[p].compressed_page_size) * overlap / page_rows;
+          segments[i].output_size += page_size * ratio;
+          segments[i].pass_size += page_size * (1 + ratio + (is_compressed ? ratio : 0));
+        }
+      }
+    }
+    // The dictionary pages are read with the first segment of a chunk in the row group
+    for (size_t i = rg_segments + 1; i < segments.size(); ++i) {
+      segments[i].dictionary_size = segments[rg_segments].dictionary_size;
+    }
+  }
+
+  // Pack consecutive segments into chunks while they fit in the limits
+  _chunks.clear();
+  _next_chunk = 0;
+  auto const add_chunk = [&](size_t begin, size_t end) {
+    if (by_row_groups) {
+      std::vector<std::vector<size_type>> row_groups(_sources.size());
+      for (auto i = begin; i < end; ++i) {
+        row_groups[segments[i].rg->source_index].push_back(segments[i].rg->index);
+      }
+      _chunks.push_back({0, 0, std::move(row_groups)});
+    } else {
+      auto const first_row = segments[begin].first_row;
+      _chunks.push_back({static_cast<size_type>(first_row),
+                         static_cast<size_type>(segments[end - 1].end_row - first_row),
+                         {}});
+    }
+  };
+  size_t chunk_begin = 0;
+  double output_size = 0;
+  double pass_size   = 0;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    auto const& seg          = segments[i];
+    auto const seg_pass_size = [&]() {
+      auto const is_first_of_rg = i == chunk_begin || seg.rg != segments[i - 1].rg;
+      return seg.pass_size + (is_first_of_rg ? seg.dictionary_size : 0);
+    };
+    if (i > chunk_begin &&
+        exceeds_limits(output_size + seg.output_size, pass_size + seg_pass_size())) {
+      add_chunk(chunk_begin, i);
+      chunk_begin = i;
+      output_size = 0;
+      pass_size   = 0;
+    }
+    output_size += seg.output_size;
+    pass_size += seg_pass_size();
+  }
+  if (not segments.empty()) { add_chunk(chunk_begin, segments.size()); }
+
+  // An empty selection is read as a single empty table
+  if (_chunks.empty()) {
+    _chunks.push_back({options.get_skip_rows(), options.get_num_rows(), row_group_list});
+  }
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::read_chunk
+ */
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No more chunks to read");
+  auto const& chunk = _chunks[_next_chunk++];
+  return read(chunk.skip_rows, chunk.num_rows, chunk.row_groups, stream);
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                parquet_reader_options const& options,
@@ -1798,6 +2686,8 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
 {
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
@@ -1809,6 +2699,28 @@ table_with_metadata reader::read(parquet_reader_options const& options,
     options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
 }
 
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::size_t pass_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(std::move(sources), options, mr);
+  _impl->setup_chunks(options, chunk_read_limit, pass_read_limit);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream) const
+{
+  return _impl->read_chunk(stream);
+}
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -33,8 +33,12 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -48,6 +52,42 @@ using namespace cudf::io;
 // Forward declarations
 class aggregate_reader_metadata;
 
+/**
+ * @brief A row group selected for reading, along with its starting row in the selection
+ */
+struct row_group_info {
+  size_type const index;
+  size_t const start_row;  // TODO source index
+  size_type const source_index;
+  row_group_info(size_type index, size_t start_row, size_type source_index)
+    : index(index), start_row(start_row), source_index(source_index)
+  {
+  }
+};
+
+/**
+ * @brief Byte ranges of a column chunk of which only some data pages are read
+ *
+ * The first `prefix_size` bytes of the chunk, holding its dictionary page if any, are read
+ * followed by the selected data pages starting at file offset `data_offset`.
+ */
+struct chunk_subrange {
+  size_t prefix_size;
+  size_t data_offset;
+};
+
+/**
+ * @brief Rows read by one chunk of a chunked read
+ *
+ * Chunks that read whole row groups list them in `row_groups`, one list per source; the other
+ * chunks read `num_rows` rows starting at row `skip_rows` of the dataset.
+ */
+struct chunk_read_info {
+  size_type skip_rows;
+  size_type num_rows;
+  std::vector<std::vector<size_type>> row_groups;
+};
+
 /**
  * @brief Implementation for Parquet reader
  */
@@ -79,7 +119,46 @@ class reader::impl {
                            std::vector<std::vector<size_type>> const& row_group_indices,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Splits the selection of the options into chunks to be read by `read_chunk`
+   *
+   * @param options Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the estimated size of each output table; 0 for no limit
+   * @param pass_read_limit Limit on the estimated device memory used to read each table; 0 for no
+   * limit
+   */
+  void setup_chunks(parquet_reader_options const& options,
+                    size_t chunk_read_limit,
+                    size_t pass_read_limit);
+
+  /**
+   * @brief Returns whether some chunks computed by `setup_chunks` have not been read yet
+   */
+  [[nodiscard]] bool has_next() const { return _next_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk computed by `setup_chunks`
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
  private:
+  /**
+   * @brief Builds the offset index of the given column chunks that have none, from the headers of
+   * their pages
+   *
+   * The page headers are parsed on the host, reading only the headers from the sources. Chunks
+   * with version 2 data pages, or whose headers cannot be parsed, are left out.
+   *
+   * @param row_groups Row groups of the column chunks
+   * @param schema_indices Schema indices of the columns of the column chunks
+   */
+  void index_page_headers(std::vector<row_group_info> const& row_groups,
+                          std::vector<int> const& schema_indices);
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -88,16 +167,64 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_subranges Byte ranges of the chunks that are only partially read
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   */
+  std::future<void> read_column_chunks(
+    std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    size_t begin_chunk,
+    size_t end_chunk,
+    const std::vector<size_t>& column_chunk_offsets,
+    std::vector<std::optional<chunk_subrange>> const& chunk_subranges,
+    std::vector<size_type> const& chunk_source_map,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads the page index of the given column chunks, if present in the file
+   *
+   * Parsed indexes are kept in `_offset_indexes` and `_column_indexes`. Chunks without a page
+   * index, or with one that cannot be parsed, are left out.
+   *
+   * @param row_groups Row groups of the column chunks
+   * @param schema_indices Schema indices of the columns of the column chunks
+   * @param with_column_index Whether to read the column index besides the offset index
+   */
+  void load_page_index(std::vector<row_group_info> const& row_groups,
+                       std::vector<int> const& schema_indices,
+                       bool with_column_index);
+
+  /**
+   * @brief Narrows down a selection of row groups to the rows that may pass the page filter
+   *
+   * Row groups in which no page may hold a value within the filter range are dropped, and the
+   * rows to read are reduced to the span from the first to the last page that may hold one.
+   *
+   * @param row_groups Selected row groups
+   * @param[out] skip_rows Number of rows to skip from the start of the remaining row groups
+   * @param[out] num_rows Number of rows to read
+   *
+   * @return Remaining row groups, with their starting rows
+   */
+  std::vector<row_group_info> apply_page_filter(std::vector<row_group_info> const& row_groups,
+                                                size_type& skip_rows,
+                                                size_type& num_rows);
+
+  /**
+   * @brief Drops the row groups in which no row can satisfy the filter predicate
+   *
+   * @param row_groups Selected row groups
+   * @param[out] skip_rows Number of rows to skip from the start of the remaining row groups
+   * @param[out] num_rows Number of rows to read
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
+   * @return Remaining row groups, with their starting rows
    */
-  std::future<void> read_column_chunks(std::vector<std::unique_ptr<datasource::buffer>>& page_data,
-                                       hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                       size_t begin_chunk,
-                                       size_t end_chunk,
-                                       const std::vector<size_t>& column_chunk_offsets,
-                                       std::vector<size_type> const& chunk_source_map,
-                                       rmm::cuda_stream_view stream);
+  std::vector<row_group_info> apply_stats_filter(std::vector<row_group_info> const& row_groups,
+                                                 size_type& skip_rows,
+                                                 size_type& num_rows,
+                                                 rmm::cuda_stream_view stream);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
@@ -210,6 +337,16 @@ class reader::impl {
 
   bool _strings_to_categorical = false;
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<parquet_page_filter> _page_filter;
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Page index of column chunks, keyed by {source index, row group index, schema index}
+  std::map<std::tuple<size_type, size_type, int>, OffsetIndex> _offset_indexes;
+  std::map<std::tuple<size_type, size_type, int>, ColumnIndex> _column_indexes;
+
+  // Chunks of a chunked read, and the index of the next one to read
+  std::vector<chunk_read_info> _chunks;
+  size_t _next_chunk = 0;
 };
 
 }  // namespace parquet
@@ -27,6 +27,7 @@
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/queued_sink.hpp>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/iterator.cuh>
@@ -64,10 +65,18 @@ using namespace cudf::io;
 
 namespace {
 /**
- * @brief Helper for pinned host memory
+ * @brief Wraps the sinks so that their host writes overlap the encoding of the next batch
  */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+std::vector<std::unique_ptr<queued_sink>> make_queued_sinks(
+  std::vector<std::unique_ptr<data_sink>>&& sinks)
+{
+  std::vector<std::unique_ptr<queued_sink>> queued_sinks;
+  queued_sinks.reserve(sinks.size());
+  for (auto& sink : sinks) {
+    queued_sinks.push_back(make_queued_sink(std::move(sink)));
+  }
+  return queued_sinks;
+}
 
 /**
  * @brief Function that translates GDF compression to parquet compression
@@ -1140,7 +1149,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     int96_timestamps(options.is_enabled_int96_timestamps()),
     kv_md(options.get_key_value_metadata()),
     single_write_mode(mode == SingleWriteMode::YES),
-    out_sink_(std::move(sinks))
+    out_sink_(make_queued_sinks(std::move(sinks)))
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
@@ -1164,7 +1173,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     int96_timestamps(options.is_enabled_int96_timestamps()),
     kv_md(options.get_key_value_metadata()),
     single_write_mode(mode == SingleWriteMode::YES),
-    out_sink_(std::move(sinks))
+    out_sink_(make_queued_sinks(std::move(sinks)))
 {
   if (options.get_metadata()) {
     table_meta = std::make_unique<table_input_metadata>(*options.get_metadata());
@@ -1440,7 +1449,6 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   size_t max_bytes_in_batch    = 1024 * 1024 * 1024;  // 1GB - TODO: Tune this
   size_t max_uncomp_bfr_size   = 0;
   size_t max_comp_bfr_size     = 0;
-  size_t max_chunk_bfr_size    = 0;
   size_type max_pages_in_batch = 0;
   size_t bytes_in_batch        = 0;
   size_t comp_bytes_in_batch   = 0;
@@ -1457,8 +1465,6 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         ck->compressed_size =
           ck->ck_stat_size + ck->page_headers_size + max_page_comp_data_size * ck->num_pages;
         comp_rowgroup_size += ck->compressed_size;
-        max_chunk_bfr_size =
-          std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
       }
     }
     // TBD: We may want to also shorten the batch if we have enough pages (not just based on size)
@@ -1518,8 +1524,6 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                        num_stats_bfr);
   }
 
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
-
   // Encode row groups in batches
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
     // Count pages in this batch
@@ -1571,26 +1575,24 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
             stream.synchronize();
           }
         } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t* ptr = nullptr;
-                                                CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
+          // copy the data into a buffer of the sink queue, so that its write overlaps the
+          // encoding of the next batch
+          auto host_bfr = out_sink_[p]->get_buffer(ck.compressed_size);
+          if (ck.ck_stat_size != 0) {
+            column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
+            CUDF_CUDA_TRY(cudaMemcpyAsync(column_chunk_meta.statistics_blob.data(),
+                                          dev_bfr,
+                                          ck.ck_stat_size,
+                                          cudaMemcpyDeviceToHost,
+                                          stream.value()));
           }
-          // copy the full data
-          CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
-                                        dev_bfr,
-                                        ck.ck_stat_size + ck.compressed_size,
+          CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr.data(),
+                                        dev_bfr + ck.ck_stat_size,
+                                        ck.compressed_size,
                                         cudaMemcpyDeviceToHost,
                                         stream.value()));
           stream.synchronize();
-          out_sink_[p]->host_write(host_bfr.get() + ck.ck_stat_size, ck.compressed_size);
-          if (ck.ck_stat_size != 0) {
-            column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
-            memcpy(column_chunk_meta.statistics_blob.data(), host_bfr.get(), ck.ck_stat_size);
-          }
+          out_sink_[p]->host_write(std::move(host_bfr), ck.compressed_size);
         }
         row_group.total_byte_size += ck.compressed_size;
         column_chunk_meta.data_page_offset =
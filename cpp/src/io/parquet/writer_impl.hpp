@@ -26,6 +26,7 @@
 
 #include <cudf/io/data_sink.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/queued_sink.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/detail/parquet.hpp>
@@ -231,7 +232,7 @@ class writer::impl {
   // a single table write.  this enables some internal optimizations.
   bool const single_write_mode = true;
 
-  std::vector<std::unique_ptr<data_sink>> out_sink_;
+  std::vector<std::unique_ptr<queued_sink>> out_sink_;
 };
 
 }  // namespace parquet
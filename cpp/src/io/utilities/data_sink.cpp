@@ -14,27 +14,112 @@
  * limitations under the License.
  */
 
-#include <fstream>
-
 #include "file_io_utilities.hpp"
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <kvikio/file_handle.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
 namespace cudf {
 namespace io {
+namespace {
+
+// Alignment of the file offsets, sizes and buffers of direct (O_DIRECT) writes
+constexpr size_t direct_io_alignment = 4096;
+
+/**
+ * @brief Returns the process-wide thread pool that writes the slices of large file writes.
+ *
+ * Its size can be set with the `LIBCUDF_FILE_SINK_THREAD_COUNT` environment variable.
+ */
+cudf::detail::thread_pool& file_write_pool()
+{
+  static cudf::detail::thread_pool pool(detail::getenv_or("LIBCUDF_FILE_SINK_THREAD_COUNT", 8u));
+  return pool;
+}
+
+/**
+ * @brief Writes a buffer at the given file offset, retrying partial and interrupted writes.
+ */
+void pwrite_all(int fd, uint8_t const* data, size_t size, size_t offset)
+{
+  while (size != 0) {
+    auto const written = pwrite(fd, data, size, offset);
+    if (written == -1 and errno == EINTR) { continue; }
+    CUDF_EXPECTS(written > 0, "Cannot write to file: " + std::string{std::strerror(errno)});
+    data += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+/**
+ * @brief Writes an aligned range of a file opened with O_DIRECT.
+ *
+ * Unaligned buffers are first copied into an aligned staging buffer of the calling thread.
+ */
+void direct_pwrite(int fd, uint8_t const* data, size_t size, size_t offset)
+{
+  if (reinterpret_cast<uintptr_t>(data) % direct_io_alignment == 0) {
+    return pwrite_all(fd, data, size, offset);
+  }
+
+  thread_local std::unique_ptr<void, decltype(&std::free)> staging{nullptr, std::free};
+  thread_local size_t staging_size = 0;
+  if (staging_size < size) {
+    staging.reset(std::aligned_alloc(direct_io_alignment, size));
+    CUDF_EXPECTS(staging != nullptr, "Cannot allocate the staging buffer for direct IO");
+    staging_size = size;
+  }
+  std::memcpy(staging.get(), data, size);
+  pwrite_all(fd, static_cast<uint8_t const*>(staging.get()), size, offset);
+}
+
+}  // namespace
+
 /**
  * @brief Implementation class for storing data into a local file.
+ *
+ * Host data is written with positional writes; writes larger than the slice size are split into
+ * slices that are written in parallel. Behavior can be tuned with environment variables:
+ * - `LIBCUDF_FILE_SINK_SLICE_SIZE`: size of the slices, in bytes; defaults to 4MB.
+ * - `LIBCUDF_FILE_SINK_DIRECT_IO`: if non-zero, the aligned part of each host write bypasses the
+ *   page cache (O_DIRECT). Falls back to buffered writes if the file system does not support it.
+ * - `LIBCUDF_FILE_SINK_SYNC_SIZE`: if non-zero, each time this many bytes are written, the new
+ *   range is written back and dropped from the page cache in the background, and `flush()` syncs
+ *   the file to storage.
  */
 class file_sink : public data_sink {
  public:
   explicit file_sink(std::string const& filepath)
+    : _file(filepath,
+            O_CREAT | O_WRONLY | O_TRUNC,
+            S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH),
+      _slice_size{util::round_up_safe(
+        std::max(detail::getenv_or<size_t>("LIBCUDF_FILE_SINK_SLICE_SIZE", 4 << 20), size_t{1}),
+        direct_io_alignment)},
+      _sync_size{detail::getenv_or<size_t>("LIBCUDF_FILE_SINK_SYNC_SIZE", 0)}
   {
-    _output_stream.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(_output_stream.is_open(), "Cannot open output file");
+    if (detail::getenv_or("LIBCUDF_FILE_SINK_DIRECT_IO", 0) != 0) {
+      try {
+        _direct_file = std::make_unique<detail::file_wrapper>(filepath, O_WRONLY | O_DIRECT);
+      } catch (cudf::logic_error const&) {
+        // Direct IO is not supported by the file system; use buffered writes only
+      }
+    }
 
     if (detail::cufile_integration::is_kvikio_enabled()) {
       _kvikio_file = kvikio::FileHandle(filepath, "w");
@@ -43,19 +128,42 @@ class file_sink : public data_sink {
     }
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    // Page cache write-back is advisory; don't report its errors from the destructor
+    if (_sync_task.valid()) { _sync_task.wait(); }
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    _output_stream.seekp(_bytes_written);
-    _output_stream.write(static_cast<char const*>(data), size);
+    auto const ptr    = static_cast<uint8_t const*>(data);
+    auto const offset = _bytes_written;
     _bytes_written += size;
+
+    if (_direct_file == nullptr) {
+      write_slices(ptr, size, offset, false);
+    } else {
+      // Only the aligned middle part can be written directly
+      auto const head = std::min(size, util::round_up_safe(offset, direct_io_alignment) - offset);
+      auto const body = util::round_down_safe(size - head, direct_io_alignment);
+      write_slices(ptr, head, offset, false);
+      write_slices(ptr + head, body, offset + head, true);
+      write_slices(ptr + head + body, size - head - body, offset + head + body, false);
+    }
+    sync_written_range();
   }
 
-  void flush() override { _output_stream.flush(); }
+  void flush() override
+  {
+    if (_sync_size == 0) { return; }
+    if (_sync_task.valid()) { _sync_task.get(); }
+    CUDF_EXPECTS(fdatasync(_file.desc()) == 0, "Cannot sync the file to storage");
+  }
 
   size_t bytes_written() override { return _bytes_written; }
 
+  [[nodiscard]] bool supports_background_writes() const override { return true; }
+
   [[nodiscard]] bool supports_device_write() const override
   {
     return !_kvikio_file.closed() || _cufile_out != nullptr;
@@ -89,12 +197,65 @@ class file_sink : public data_sink {
   void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
   {
     if (!supports_device_write()) CUDF_FAIL("Device writes are not supported for this file.");
-    return device_write_async(gpu_data, _bytes_written, stream).get();
+    return device_write_async(gpu_data, size, stream).get();
   }
 
  private:
-  std::ofstream _output_stream;
+  /**
+   * @brief Writes a range of the file, in parallel slices if it is larger than the slice size.
+   */
+  void write_slices(uint8_t const* data, size_t size, size_t offset, bool direct)
+  {
+    auto const fd    = direct ? _direct_file->desc() : _file.desc();
+    auto const write_fn = direct ? direct_pwrite : pwrite_all;
+    if (size <= _slice_size) {
+      if (size != 0) { write_fn(fd, data, size, offset); }
+      return;
+    }
+
+    std::vector<std::future<void>> slice_tasks;
+    for (auto const& slice : detail::make_file_io_slices(size, _slice_size)) {
+      slice_tasks.push_back(file_write_pool().submit(
+        write_fn, fd, data + slice.offset, slice.size, offset + slice.offset));
+    }
+    // Wait for all slices before rethrowing, as they read from the caller's buffer
+    for (auto const& task : slice_tasks) {
+      task.wait();
+    }
+    for (auto& task : slice_tasks) {
+      task.get();
+    }
+  }
+
+  /**
+   * @brief Starts the write-back of the range written since the last sync, if large enough.
+   *
+   * Waits for the previous write-back first, which bounds the amount of dirty data in the page
+   * cache.
+   */
+  void sync_written_range()
+  {
+    if (_sync_size == 0 or _bytes_written - _synced_bytes < _sync_size) { return; }
+    if (_sync_task.valid()) { _sync_task.get(); }
+    _sync_task = file_write_pool().submit(
+      [fd = _file.desc(), offset = _synced_bytes, size = _bytes_written - _synced_bytes] {
+        sync_file_range(fd,
+                        offset,
+                        size,
+                        SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE |
+                          SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(fd, offset, size, POSIX_FADV_DONTNEED);
+      });
+    _synced_bytes = _bytes_written;
+  }
+
+  detail::file_wrapper _file;
+  std::unique_ptr<detail::file_wrapper> _direct_file;  // Null if direct IO is not used
+  size_t const _slice_size;
+  size_t const _sync_size;
   size_t _bytes_written = 0;
+  size_t _synced_bytes  = 0;
+  std::future<void> _sync_task;
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
   kvikio::FileHandle _kvikio_file;
 };
@@ -114,6 +275,8 @@ class host_buffer_sink : public data_sink {
     buffer_->insert(buffer_->end(), char_array, char_array + size);
   }
 
+  [[nodiscard]] bool supports_background_writes() const override { return true; }
+
   void flush() override {}
 
   size_t bytes_written() override { return buffer_->size(); }
@@ -122,6 +285,57 @@ class host_buffer_sink : public data_sink {
   std::vector<char>* buffer_;
 };
 
+segmented_host_buffer_sink::segmented_host_buffer_sink(size_t segment_size)
+  : _segment_size{std::max(segment_size, size_t{1})}
+{
+}
+
+void segmented_host_buffer_sink::host_write(void const* data, size_t size)
+{
+  auto ptr = static_cast<uint8_t const*>(data);
+  _bytes_written += size;
+  while (size != 0) {
+    if (_segments.empty() or _segments.back().size == _segments.back().capacity) {
+      // Not value-initialized, as the whole segment is overwritten
+      auto const capacity = std::max(_segment_size, size);
+      _segments.push_back({std::unique_ptr<uint8_t[]>(new uint8_t[capacity]), 0, capacity});
+    }
+    auto& last         = _segments.back();
+    auto const to_copy = std::min(size, last.capacity - last.size);
+    std::memcpy(last.data.get() + last.size, ptr, to_copy);
+    last.size += to_copy;
+    ptr += to_copy;
+    size -= to_copy;
+  }
+}
+
+std::vector<host_span<uint8_t const>> segmented_host_buffer_sink::segments() const
+{
+  std::vector<host_span<uint8_t const>> spans;
+  spans.reserve(_segments.size());
+  for (auto const& seg : _segments) {
+    spans.emplace_back(seg.data.get(), seg.size);
+  }
+  return spans;
+}
+
+host_span<uint8_t const> segmented_host_buffer_sink::consolidate()
+{
+  if (_segments.size() > 1) {
+    auto const size = _bytes_written;
+    segment consolidated{std::unique_ptr<uint8_t[]>(new uint8_t[size]), 0, size};
+    for (auto& seg : _segments) {
+      std::memcpy(consolidated.data.get() + consolidated.size, seg.data.get(), seg.size);
+      consolidated.size += seg.size;
+      seg.data.reset();
+    }
+    _segments.clear();
+    _segments.push_back(std::move(consolidated));
+  }
+  if (_segments.empty()) { return {}; }
+  return {_segments.front().data.get(), _segments.front().size};
+}
+
 /**
  * @brief Implementation class for voiding data (no io performed)
  */
@@ -133,6 +347,8 @@ class void_sink : public data_sink {
 
   void host_write(void const* data, size_t size) override { _bytes_written += size; }
 
+  [[nodiscard]] bool supports_background_writes() const override { return true; }
+
   [[nodiscard]] bool supports_device_write() const override { return true; }
 
   void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
@@ -185,6 +401,11 @@ class user_sink_wrapper : public data_sink {
     return user_sink->device_write_async(gpu_data, size, stream);
   }
 
+  [[nodiscard]] bool supports_background_writes() const override
+  {
+    return user_sink->supports_background_writes();
+  }
+
   void flush() override { user_sink->flush(); }
 
   size_t bytes_written() override { return user_sink->bytes_written(); }
@@ -15,9 +15,11 @@
  */
 
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
+#include <io/comp/io_uncomp.hpp>
 #include <io/utilities/config_utils.hpp>
 
 #include <kvikio/file_handle.hpp>
@@ -25,18 +27,69 @@
 
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace {
 
+/**
+ * @brief Returns the thread pool used for parallel host reads.
+ */
+cudf::detail::thread_pool& host_read_pool()
+{
+  static cudf::detail::thread_pool pool(detail::getenv_or("LIBCUDF_IO_THREAD_COUNT", 8));
+  return pool;
+}
+
+/**
+ * @brief Returns the thread pool used to read the slices of large file reads.
+ *
+ * Separate from `host_read_pool` because the tasks of that pool wait for slice reads.
+ */
+cudf::detail::thread_pool& file_slice_read_pool()
+{
+  static cudf::detail::thread_pool pool(detail::getenv_or("LIBCUDF_IO_THREAD_COUNT", 8));
+  return pool;
+}
+
+/**
+ * @brief Buffer that references a part of a buffer shared with other slices.
+ */
+class buffer_slice : public datasource::buffer {
+ public:
+  buffer_slice(std::shared_ptr<datasource::buffer> parent, size_t offset, size_t size)
+    : _parent(std::move(parent)),
+      _offset(std::min(offset, _parent->size())),
+      _size(std::min(size, _parent->size() - _offset))
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _parent->data() + _offset; }
+
+ private:
+  std::shared_ptr<datasource::buffer> _parent;
+  size_t _offset;
+  size_t _size;
+};
+
 /**
  * @brief Base class for file input. Only implements direct device reads.
  */
 class file_source : public datasource {
  public:
-  explicit file_source(const char* filepath) : _file(filepath, O_RDONLY)
+  explicit file_source(const char* filepath) : _file(filepath, O_RDONLY), _filepath(filepath)
   {
     if (detail::cufile_integration::is_kvikio_enabled()) {
       _kvikio_file = kvikio::FileHandle(filepath);
@@ -90,10 +143,26 @@ class file_source : public datasource {
 
   [[nodiscard]] size_t size() const override { return _file.size(); }
 
+  /**
+   * @brief Returns a key made of the canonical file path, the file size and the modification time.
+   */
+  [[nodiscard]] std::string cache_key() const override
+  {
+    struct stat st;
+    if (fstat(_file.desc(), &st) != 0) { return {}; }
+
+    std::unique_ptr<char, decltype(&std::free)> real_path{realpath(_filepath.c_str(), nullptr),
+                                                          &std::free};
+    auto const path = (real_path != nullptr) ? std::string{real_path.get()} : _filepath;
+    return path + ':' + std::to_string(st.st_size) + ':' + std::to_string(st.st_mtim.tv_sec) + '.' +
+           std::to_string(st.st_mtim.tv_nsec);
+  }
+
  protected:
   detail::file_wrapper _file;
 
  private:
+  std::string _filepath;
   std::unique_ptr<detail::cufile_input_impl> _cufile_in;
   kvikio::FileHandle _kvikio_file;
 };
@@ -140,6 +209,32 @@ class memory_mapped_source : public file_source {
     return read_size;
   }
 
+  /**
+   * @brief Starts reading the range into the page cache, and returns a buffer that references
+   * the mapping.
+   */
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    auto read_buffer = host_read(offset, size);
+    read_ahead(offset, read_buffer->size());
+
+    std::promise<std::unique_ptr<buffer>> result;
+    result.set_value(std::move(read_buffer));
+    return result.get_future();
+  }
+
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    std::vector<read_range> const& ranges) override
+  {
+    // Reads from the mapping do not copy the data, so there is nothing to gain from merging; the
+    // kernel is only asked to read all ranges ahead of their use
+    auto buffers = datasource::host_read_ranges(ranges);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      read_ahead(ranges[i].offset, buffers[i]->size());
+    }
+    return buffers;
+  }
+
  private:
   void map(int fd, size_t offset, size_t size)
   {
@@ -158,6 +253,24 @@ class memory_mapped_source : public file_source {
     CUDF_EXPECTS(_map_addr != MAP_FAILED, "Cannot create memory mapping");
   }
 
+  /**
+   * @brief Advises the kernel that a range of the mapping will be accessed soon.
+   *
+   * The advice is a hint; failures are ignored.
+   */
+  void read_ahead(size_t offset, size_t size)
+  {
+    static auto const is_enabled = detail::getenv_or("LIBCUDF_MMAP_READ_AHEAD", 1) != 0;
+    if (not is_enabled or size == 0) { return; }
+
+    // Address for `madvise()` must be page aligned
+    auto const page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const begin     = (offset - _map_offset) & ~(page_size - 1);
+    auto const end       = std::min(offset - _map_offset + size, _map_size);
+    auto const addr      = static_cast<uint8_t*>(_map_addr) + begin;
+    static_cast<void>(madvise(addr, end - begin, MADV_WILLNEED));
+  }
+
  private:
   size_t _map_size   = 0;
   size_t _map_offset = 0;
@@ -165,10 +278,11 @@ class memory_mapped_source : public file_source {
 };
 
 /**
- * @brief Implementation class for reading from a file using `read` calls
+ * @brief Implementation class for reading from a file using `pread` calls
  *
  * Potentially faster than `memory_mapped_source` when only a small portion of the file is read
- * through the host.
+ * through the host. Reads are thread-safe; large reads are split into slices that are read in
+ * parallel.
  */
 class direct_read_source : public file_source {
  public:
@@ -176,27 +290,61 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
-    ssize_t const read_size = std::min(size, _file.size() - offset);
+    offset               = std::min(offset, _file.size());
+    auto const read_size = std::min(size, _file.size() - offset);
 
-    std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
-    return buffer::create(std::move(v));
+    // Not value-initialized, as the read overwrites the whole allocation
+    std::unique_ptr<uint8_t[]> data(new uint8_t[read_size]);
+    auto const data_ptr = data.get();
+    host_read(offset, read_size, data_ptr);
+    return std::make_unique<owning_buffer<std::unique_ptr<uint8_t[]>>>(
+      std::move(data), data_ptr, read_size);
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
+    constexpr size_t default_max_slice_size = 4 * 1024 * 1024;
+    static auto const max_slice_size =
+      detail::getenv_or("LIBCUDF_IO_SLICE_SIZE", default_max_slice_size);
 
-    // Clamp length to available data
-    auto const read_size = std::min(size, _file.size() - offset);
+    return detail::sliced_host_read(
+      _file, offset, size, dst, max_slice_size, file_slice_read_pool());
+  }
+
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    std::vector<read_range> const& ranges) override
+  {
+    return coalesced_host_read(ranges);
+  }
+};
+
+/**
+ * @brief Implementation class for reading from a host buffer owned by the source.
+ */
+class owning_host_source : public datasource {
+ public:
+  explicit owning_host_source(std::vector<uint8_t>&& data) : _data(std::move(data)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    offset = std::min(offset, _data.size());
+    return std::make_unique<non_owning_buffer>(_data.data() + offset,
+                                               std::min(size, _data.size() - offset));
+  }
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
-                 "read failed");
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    offset               = std::min(offset, _data.size());
+    auto const read_size = std::min(size, _data.size() - offset);
+    std::memcpy(dst, _data.data() + offset, read_size);
     return read_size;
   }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+ private:
+  std::vector<uint8_t> _data;
 };
 
 /**
@@ -220,6 +368,17 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::future<std::unique_ptr<buffer>> host_read_async(size_t offset, size_t size) override
+  {
+    return source->host_read_async(offset, size);
+  }
+
+  std::vector<std::unique_ptr<buffer>> host_read_ranges(
+    std::vector<read_range> const& ranges) override
+  {
+    return source->host_read_ranges(ranges);
+  }
+
   [[nodiscard]] bool supports_device_read() const override
   {
     return source->supports_device_read();
@@ -242,12 +401,86 @@ class user_datasource_wrapper : public datasource {
 
   [[nodiscard]] size_t size() const override { return source->size(); }
 
+  [[nodiscard]] std::string cache_key() const override { return source->cache_key(); }
+
  private:
   datasource* const source;  ///< A non-owning pointer to the user-implemented datasource
 };
 
 }  // namespace
 
+std::future<std::unique_ptr<datasource::buffer>> datasource::host_read_async(size_t offset,
+                                                                             size_t size)
+{
+  return host_read_pool().submit([this, offset, size]() { return host_read(offset, size); });
+}
+
+std::vector<std::unique_ptr<datasource::buffer>> datasource::coalesced_host_read(
+  std::vector<read_range> const& ranges)
+{
+  constexpr size_t default_max_gap_size = 64 * 1024;
+  static auto const max_gap_size =
+    detail::getenv_or("LIBCUDF_IO_COALESCE_GAP_SIZE", default_max_gap_size);
+
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  // Group the ranges that are close enough to be read together; each group is in `order`
+  std::vector<std::pair<size_t, size_t>> groups;
+  for (size_t i = 0; i < order.size();) {
+    auto group_end = ranges[order[i]].offset + ranges[order[i]].size;
+    size_t next    = i + 1;
+    while (next < order.size() && ranges[order[next]].offset <= group_end + max_gap_size) {
+      group_end = std::max(group_end, ranges[order[next]].offset + ranges[order[next]].size);
+      ++next;
+    }
+    groups.emplace_back(i, next);
+    i = next;
+  }
+
+  std::vector<std::unique_ptr<datasource::buffer>> buffers(ranges.size());
+  auto read_group = [&](size_t first, size_t last) {
+    if (last - first == 1) {
+      auto const& range     = ranges[order[first]];
+      buffers[order[first]] = host_read(range.offset, range.size);
+      return;
+    }
+    auto const group_offset = ranges[order[first]].offset;
+    size_t group_end        = group_offset;
+    for (auto i = first; i < last; ++i) {
+      group_end = std::max(group_end, ranges[order[i]].offset + ranges[order[i]].size);
+    }
+    std::shared_ptr<datasource::buffer> const group_buffer =
+      host_read(group_offset, group_end - group_offset);
+    for (auto i = first; i < last; ++i) {
+      auto const& range = ranges[order[i]];
+      buffers[order[i]] =
+        std::make_unique<buffer_slice>(group_buffer, range.offset - group_offset, range.size);
+    }
+  };
+
+  if (groups.size() == 1) {
+    read_group(groups[0].first, groups[0].second);
+    return buffers;
+  }
+  std::vector<std::future<void>> read_tasks;
+  read_tasks.reserve(groups.size());
+  for (auto const& [first, last] : groups) {
+    read_tasks.emplace_back(host_read_pool().submit(read_group, first, last));
+  }
+  // Wait for all reads before rethrowing any error, as the reads reference the local state
+  for (auto& task : read_tasks) {
+    task.wait();
+  }
+  for (auto& task : read_tasks) {
+    task.get();
+  }
+  return buffers;
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
                                                size_t offset,
                                                size_t size)
@@ -275,5 +508,40 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::vector<std::unique_ptr<datasource>> datasource::create_from_zip_entries(
+  datasource* archive, std::vector<std::string> const& entry_names)
+{
+  auto const buffer = archive->host_read(0, archive->size());
+  host_span<uint8_t const> const src{buffer->data(), buffer->size()};
+  auto const archive_entries = list_zip_entries(src);
+  CUDF_EXPECTS(not archive_entries.empty(), "Source is not a ZIP archive");
+
+  std::vector<zip_entry> entries;
+  if (entry_names.empty()) {
+    std::copy_if(archive_entries.cbegin(),
+                 archive_entries.cend(),
+                 std::back_inserter(entries),
+                 [](auto const& entry) {
+                   return not entry.name.empty() and entry.name.back() != '/';
+                 });
+  } else {
+    for (auto const& name : entry_names) {
+      auto const it = std::find_if(archive_entries.cbegin(),
+                                   archive_entries.cend(),
+                                   [&](auto const& entry) { return entry.name == name; });
+      CUDF_EXPECTS(it != archive_entries.cend(), "ZIP archive has no entry " + name);
+      entries.push_back(*it);
+    }
+  }
+
+  auto entry_data = decompress_zip_entries(src, entries);
+  std::vector<std::unique_ptr<datasource>> sources;
+  sources.reserve(entry_data.size());
+  for (auto& data : entry_data) {
+    sources.emplace_back(std::make_unique<owning_host_source>(std::move(data)));
+  }
+  return sources;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -21,7 +21,9 @@
 
 #include <dlfcn.h>
 
+#include <cerrno>
 #include <fstream>
+#include <future>
 #include <numeric>
 
 namespace cudf {
@@ -302,6 +304,51 @@ std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_siz
   return slices;
 }
 
+size_t pread_all(int fd, uint8_t* dst, size_t size, size_t offset, pread_function read)
+{
+  size_t bytes_read = 0;
+  while (bytes_read < size) {
+    auto const result = read(fd, dst + bytes_read, size - bytes_read, offset + bytes_read);
+    if (result == -1 && errno == EINTR) { continue; }
+    CUDF_EXPECTS(result > 0, "read failed");
+    bytes_read += result;
+  }
+  return bytes_read;
+}
+
+size_t sliced_host_read(file_wrapper const& file,
+                        size_t offset,
+                        size_t size,
+                        uint8_t* dst,
+                        size_t max_slice_size,
+                        cudf::detail::thread_pool& pool,
+                        pread_function read)
+{
+  // Clamp the range to the available data
+  offset               = std::min(offset, file.size());
+  auto const read_size = std::min(size, file.size() - offset);
+
+  auto const slices = make_file_io_slices(read_size, max_slice_size);
+  if (slices.size() <= 1) { return pread_all(file.desc(), dst, read_size, offset, read); }
+
+  auto read_slice = [fd = file.desc(), read](uint8_t* dst, size_t size, size_t offset) {
+    return pread_all(fd, dst, size, offset, read);
+  };
+  std::vector<std::future<size_t>> slice_tasks;
+  slice_tasks.reserve(slices.size());
+  for (auto const& slice : slices) {
+    slice_tasks.emplace_back(
+      pool.submit(read_slice, dst + slice.offset, slice.size, offset + slice.offset));
+  }
+  // Wait for all slices before rethrowing any error, as the reads write to `dst`
+  for (auto& task : slice_tasks) {
+    task.wait();
+  }
+  return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0ul, [](auto sum, auto& task) {
+    return sum + task.get();
+  });
+}
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -16,9 +16,9 @@
 
 #pragma once
 
-#ifdef CUFILE_FOUND
 #include "thread_pool.hpp"
 
+#ifdef CUFILE_FOUND
 #include <cudf_test/file_utilities.hpp>
 #include <cufile.h>
 #endif
@@ -28,6 +28,8 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <unistd.h>
+
 #include <string>
 
 namespace cudf {
@@ -243,6 +245,53 @@ struct file_io_slice {
  */
 std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_size);
 
+/**
+ * @brief Signature of `pread`, used to read the file in `pread_all` and `sliced_host_read`.
+ */
+using pread_function = ssize_t (*)(int, void*, size_t, off_t);
+
+/**
+ * @brief Reads a range of a file with `pread`, continuing after interrupted and partial reads.
+ *
+ * @throws cudf::logic_error if a read fails or the file ends before the range does
+ *
+ * @param fd File descriptor
+ * @param dst Address of the existing host memory
+ * @param size Number of bytes to read
+ * @param offset Number of bytes from the start
+ * @param read Function that performs the reads
+ *
+ * @return The number of bytes read
+ */
+size_t pread_all(int fd, uint8_t* dst, size_t size, size_t offset, pread_function read = &pread);
+
+/**
+ * @brief Reads a range of a file into host memory; large reads are split into slices that are
+ * read in parallel.
+ *
+ * The range is clamped to the end of the file. Thread-safe, as `pread` does not use the file
+ * position.
+ *
+ * @throws cudf::logic_error if a read fails
+ *
+ * @param file File to read from
+ * @param offset Number of bytes from the start
+ * @param size Number of bytes to read
+ * @param dst Address of the existing host memory
+ * @param max_slice_size Maximum size of the slices; see `make_file_io_slices`
+ * @param pool Thread pool that reads the slices; its tasks must not wait for reads on this pool
+ * @param read Function that performs the reads
+ *
+ * @return The number of bytes read
+ */
+size_t sliced_host_read(file_wrapper const& file,
+                        size_t offset,
+                        size_t size,
+                        uint8_t* dst,
+                        size_t max_slice_size,
+                        cudf::detail::thread_pool& pool,
+                        pread_function read = &pread);
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
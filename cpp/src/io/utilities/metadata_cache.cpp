@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+namespace cudf::io {
+namespace detail {
+
+metadata_cache::metadata_cache()
+{
+  _stats.capacity = getenv_or<std::size_t>("LIBCUDF_METADATA_CACHE_SIZE", 0);
+}
+
+metadata_cache& metadata_cache::instance()
+{
+  static metadata_cache cache;
+  return cache;
+}
+
+std::string metadata_cache::make_key(datasource const& source, std::string_view format) const
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stats.capacity == 0) { return {}; }
+  }
+
+  auto const source_key = source.cache_key();
+  if (source_key.empty()) { return {}; }
+  return std::string{format} + ':' + source_key;
+}
+
+std::shared_ptr<void const> metadata_cache::find_entry(std::string const& key)
+{
+  if (key.empty()) { return nullptr; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _index.find(key);
+  if (it == _index.end()) {
+    ++_stats.misses;
+    return nullptr;
+  }
+  ++_stats.hits;
+  _entries.splice(_entries.begin(), _entries, it->second);
+  return it->second->metadata;
+}
+
+void metadata_cache::insert(std::string const& key,
+                            std::shared_ptr<void const> metadata,
+                            std::size_t size)
+{
+  if (key.empty()) { return; }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (size > _stats.capacity) { return; }
+
+  // Another reader may have added the same metadata in the meantime
+  if (auto const it = _index.find(key); it != _index.end()) {
+    _stats.size -= it->second->size;
+    _entries.erase(it->second);
+    _index.erase(it);
+  }
+  evict(_stats.capacity - size);
+
+  _entries.push_front({key, std::move(metadata), size});
+  _index.emplace(key, _entries.begin());
+  _stats.size += size;
+}
+
+void metadata_cache::evict(std::size_t capacity)
+{
+  while (_stats.size > capacity) {
+    auto const& lru = _entries.back();
+    _stats.size -= lru.size;
+    _index.erase(lru.key);
+    _entries.pop_back();
+    ++_stats.evictions;
+  }
+}
+
+void metadata_cache::set_capacity(std::size_t capacity)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _stats.capacity = capacity;
+  evict(capacity);
+}
+
+metadata_cache_stats metadata_cache::stats() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _stats;
+}
+
+void metadata_cache::clear()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _entries.clear();
+  _index.clear();
+  _stats = metadata_cache_stats{0, 0, 0, 0, _stats.capacity};
+}
+
+}  // namespace detail
+
+void set_metadata_cache_capacity(std::size_t capacity)
+{
+  detail::metadata_cache::instance().set_capacity(capacity);
+}
+
+metadata_cache_stats get_metadata_cache_stats()
+{
+  return detail::metadata_cache::instance().stats();
+}
+
+void clear_metadata_cache() { detail::metadata_cache::instance().clear(); }
+
+}  // namespace cudf::io
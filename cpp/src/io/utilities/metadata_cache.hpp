@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/metadata_cache.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Process-wide LRU cache of parsed file metadata.
+ *
+ * Entries are type-erased; the key includes the file format so that each key is always
+ * associated with the same metadata type.
+ */
+class metadata_cache {
+ public:
+  /**
+   * @brief Returns the process-wide cache instance.
+   */
+  static metadata_cache& instance();
+
+  /**
+   * @brief Returns the key of the metadata of a source in the given format.
+   *
+   * @return Cache key; an empty string if the source or its metadata cannot be cached
+   */
+  [[nodiscard]] std::string make_key(datasource const& source, std::string_view format) const;
+
+  /**
+   * @brief Returns the cached metadata for the key and counts the lookup as a hit or a miss.
+   *
+   * @return Cached metadata; `nullptr` if the key is empty or not in the cache
+   */
+  template <typename T>
+  [[nodiscard]] std::shared_ptr<T const> find(std::string const& key)
+  {
+    return std::static_pointer_cast<T const>(find_entry(key));
+  }
+
+  /**
+   * @brief Adds metadata to the cache, evicting least recently used entries as needed.
+   *
+   * Does nothing if the key is empty or the entry does not fit in the cache.
+   *
+   * @param key Key of the metadata
+   * @param metadata Parsed metadata
+   * @param size Size of the entry, in bytes
+   */
+  void insert(std::string const& key, std::shared_ptr<void const> metadata, std::size_t size);
+
+  void set_capacity(std::size_t capacity);
+
+  [[nodiscard]] metadata_cache_stats stats() const;
+
+  void clear();
+
+ private:
+  metadata_cache();
+
+  std::shared_ptr<void const> find_entry(std::string const& key);
+
+  void evict(std::size_t capacity);
+
+  struct entry {
+    std::string key;
+    std::shared_ptr<void const> metadata;
+    std::size_t size;
+  };
+
+  mutable std::mutex _mutex;
+  std::list<entry> _entries;  // Most recently used first
+  std::unordered_map<std::string, std::list<entry>::iterator> _index;
+  metadata_cache_stats _stats{};
+};
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "queued_sink.hpp"
+
+#include <io/utilities/config_utils.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf::io::detail {
+
+queued_sink::buffer::buffer(std::size_t capacity) : _capacity{capacity}
+{
+  uint8_t* ptr = nullptr;
+  CUDF_CUDA_TRY(cudaMallocHost(&ptr, capacity));
+  _data.reset(ptr);
+}
+
+queued_sink::queued_sink(std::unique_ptr<data_sink>&& sink, std::size_t max_queued_bytes)
+  : _sink{std::move(sink)},
+    _max_queued_bytes{max_queued_bytes},
+    _bytes_written{_sink->bytes_written()}
+{
+  if (_max_queued_bytes != 0) { _writer = std::make_unique<cudf::detail::thread_pool>(1); }
+}
+
+queued_sink::~queued_sink()
+{
+  // Errors can't be reported from here; only wait for the writes to complete
+  for (auto& write : _queue) {
+    if (write.done.valid()) { write.done.wait(); }
+  }
+}
+
+void queued_sink::wait_for_writes(std::size_t max_queued_bytes)
+{
+  while (not _queue.empty() and _queued_bytes > max_queued_bytes) {
+    auto write = std::move(_queue.front());
+    _queue.pop_front();
+    _queued_bytes -= write.queued_bytes;
+    // The buffer can only be reused, or freed, once written
+    write.done.get();
+    release(std::move(write.data));
+  }
+}
+
+void queued_sink::release(buffer&& data)
+{
+  if (data.capacity() == 0) { return; }
+  _free_buffers.push_back(std::move(data));
+  // Keep the largest buffers, within the size of the queue
+  std::sort(_free_buffers.begin(), _free_buffers.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.capacity() > rhs.capacity();
+  });
+  auto const max_free_bytes = std::max(_max_queued_bytes, _free_buffers.front().capacity());
+  std::size_t free_bytes    = 0;
+  auto const end =
+    std::find_if(_free_buffers.begin(), _free_buffers.end(), [&](auto const& free_buffer) {
+      free_bytes += free_buffer.capacity();
+      return free_bytes > max_free_bytes;
+    });
+  _free_buffers.erase(end, _free_buffers.end());
+}
+
+queued_sink::buffer queued_sink::get_buffer(std::size_t size)
+{
+  wait_for_writes(_max_queued_bytes > size ? _max_queued_bytes - size : 0);
+
+  // Smallest free buffer that fits; the free buffers are sorted by decreasing capacity
+  auto const it = std::find_if(_free_buffers.rbegin(), _free_buffers.rend(), [&](auto const& b) {
+    return b.capacity() >= size;
+  });
+  if (it == _free_buffers.rend()) { return buffer{std::max<std::size_t>(size, 1)}; }
+  auto data = std::move(*it);
+  _free_buffers.erase(std::next(it).base());
+  return data;
+}
+
+void queued_sink::host_write(buffer&& data, std::size_t size)
+{
+  CUDF_EXPECTS(size <= data.capacity(), "Write size exceeds the size of the buffer");
+  _bytes_written += size;
+  if (_writer == nullptr) {
+    _sink->host_write(data.data(), size);
+    release(std::move(data));
+    return;
+  }
+
+  auto const ptr      = data.data();
+  auto const capacity = data.capacity();
+  auto done = _writer->submit([sink = _sink.get(), ptr, size]() { sink->host_write(ptr, size); });
+  _queued_bytes += capacity;
+  _queue.push_back({std::move(data), capacity, std::move(done)});
+}
+
+void queued_sink::host_write(void const* data, std::size_t size)
+{
+  if (_writer == nullptr) {
+    _sink->host_write(data, size);
+    _bytes_written += size;
+    return;
+  }
+
+  wait_for_writes(_max_queued_bytes > size ? _max_queued_bytes - size : 0);
+  auto copy = std::make_shared<std::vector<uint8_t>>(size);
+  std::memcpy(copy->data(), data, size);
+  auto done = _writer->submit([sink = _sink.get(), copy]() {
+    sink->host_write(copy->data(), copy->size());
+  });
+  _bytes_written += size;
+  _queued_bytes += size;
+  _queue.push_back({buffer{}, size, std::move(done)});
+}
+
+bool queued_sink::supports_device_write() const { return _sink->supports_device_write(); }
+
+bool queued_sink::is_device_write_preferred(std::size_t size) const
+{
+  return _sink->is_device_write_preferred(size);
+}
+
+void queued_sink::device_write(void const* gpu_data,
+                               std::size_t size,
+                               rmm::cuda_stream_view stream)
+{
+  wait_for_writes(0);
+  _sink->device_write(gpu_data, size, stream);
+  _bytes_written += size;
+}
+
+std::future<void> queued_sink::device_write_async(void const* gpu_data,
+                                                  std::size_t size,
+                                                  rmm::cuda_stream_view stream)
+{
+  wait_for_writes(0);
+  _bytes_written += size;
+  return _sink->device_write_async(gpu_data, size, stream);
+}
+
+void queued_sink::flush()
+{
+  wait_for_writes(0);
+  _sink->flush();
+}
+
+std::unique_ptr<queued_sink> make_queued_sink(std::unique_ptr<data_sink>&& sink)
+{
+  static auto const max_queued_bytes =
+    getenv_or<std::size_t>("LIBCUDF_SINK_QUEUE_SIZE", 128 * 1024 * 1024);
+  auto const queue_size = sink->supports_background_writes() ? max_queued_bytes : 0;
+  return std::make_unique<queued_sink>(std::move(sink), queue_size);
+}
+
+}  // namespace cudf::io::detail
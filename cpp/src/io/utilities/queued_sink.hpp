@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/io/data_sink.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Sink that writes host data to another sink on a background thread.
+ *
+ * Host writes return once their data is queued, so that the writers encode the next batch of data
+ * while the previous one is written to the sink. The queue holds at most `max_queued_bytes`; a
+ * write that does not fit waits for the oldest writes to complete. Writes reach the wrapped sink in
+ * order, as device writes and `flush` first wait for the queued writes. An error of a queued write
+ * is rethrown by a later call to the sink.
+ */
+class queued_sink : public data_sink {
+ public:
+  /**
+   * @brief Pinned host buffer of a queued write.
+   */
+  class buffer {
+   public:
+    buffer() = default;
+
+    [[nodiscard]] uint8_t* data() const { return _data.get(); }
+    [[nodiscard]] std::size_t capacity() const { return _capacity; }
+
+   private:
+    friend class queued_sink;
+    explicit buffer(std::size_t capacity);
+
+    std::unique_ptr<uint8_t, decltype(&cudaFreeHost)> _data{nullptr, cudaFreeHost};
+    std::size_t _capacity = 0;
+  };
+
+  /**
+   * @brief Constructor wrapping a sink.
+   *
+   * @param sink Sink to write to
+   * @param max_queued_bytes Maximum size of the queued writes; 0 to write synchronously
+   */
+  queued_sink(std::unique_ptr<data_sink>&& sink, std::size_t max_queued_bytes);
+
+  /**
+   * @brief Destructor, waiting for the queued writes.
+   */
+  ~queued_sink() override;
+
+  /**
+   * @brief Returns a host buffer of at least `size` bytes, to fill and pass to `host_write`.
+   *
+   * Buffers of completed writes are reused. Waits for the oldest writes if the queue does not have
+   * room for the buffer.
+   *
+   * @param size Minimum size of the buffer, in bytes
+   *
+   * @return Pinned host buffer
+   */
+  buffer get_buffer(std::size_t size);
+
+  /**
+   * @brief Queues the write of the first bytes of a buffer obtained from `get_buffer`.
+   *
+   * Unlike the write of a host pointer, the data is not copied.
+   *
+   * @param data Buffer to write; it is reused once written
+   * @param size Number of bytes to write
+   */
+  void host_write(buffer&& data, std::size_t size);
+
+  void host_write(void const* data, std::size_t size) override;
+
+  [[nodiscard]] bool supports_device_write() const override;
+
+  [[nodiscard]] bool is_device_write_preferred(std::size_t size) const override;
+
+  void device_write(void const* gpu_data, std::size_t size, rmm::cuda_stream_view stream) override;
+
+  std::future<void> device_write_async(void const* gpu_data,
+                                       std::size_t size,
+                                       rmm::cuda_stream_view stream) override;
+
+  void flush() override;
+
+  std::size_t bytes_written() override { return _bytes_written; }
+
+ private:
+  /**
+   * @brief Waits for the oldest writes until at most `max_queued_bytes` are queued.
+   */
+  void wait_for_writes(std::size_t max_queued_bytes);
+
+  /**
+   * @brief Keeps a written buffer for reuse, within the size of the queue.
+   */
+  void release(buffer&& data);
+
+  struct queued_write {
+    buffer data;
+    std::size_t queued_bytes;
+    std::future<void> done;
+  };
+
+  std::unique_ptr<data_sink> _sink;
+  std::size_t const _max_queued_bytes;
+  std::size_t _bytes_written;
+  std::size_t _queued_bytes = 0;
+  std::deque<queued_write> _queue;
+  std::vector<buffer> _free_buffers;
+  std::unique_ptr<cudf::detail::thread_pool> _writer;  // Single thread; null if synchronous
+};
+
+/**
+ * @brief Wraps a sink into a `queued_sink`.
+ *
+ * The size of the queue can be set with the `LIBCUDF_SINK_QUEUE_SIZE` environment variable, in
+ * bytes, and defaults to 128MB; 0 disables the background writes. Sinks that do not support
+ * background writes are always written on the caller's thread.
+ */
+std::unique_ptr<queued_sink> make_queued_sink(std::unique_ptr<data_sink>&& sink);
+
+}  // namespace cudf::io::detail
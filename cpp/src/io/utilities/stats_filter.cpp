@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats_filter.hpp"
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf::io::detail {
+namespace {
+
+/**
+ * @brief Functor that reads the value of a fixed-width scalar, widened to a statistics value
+ */
+struct scalar_to_stats_value {
+  template <typename T>
+  std::optional<column_block_stats::value_type> operator()(scalar const& value,
+                                                           rmm::cuda_stream_view stream) const
+  {
+    if constexpr (cudf::is_fixed_width<T>() and not cudf::is_fixed_point<T>()) {
+      auto const host_value = static_cast<fixed_width_scalar<T> const&>(value).value(stream);
+      if constexpr (cudf::is_timestamp<T>()) {
+        return static_cast<int64_t>(host_value.time_since_epoch().count());
+      } else if constexpr (cudf::is_duration<T>()) {
+        return static_cast<int64_t>(host_value.count());
+      } else if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<double>(host_value);
+      } else if constexpr (std::is_unsigned_v<T> and not std::is_same_v<T, bool>) {
+        return static_cast<uint64_t>(host_value);
+      } else {
+        return static_cast<int64_t>(host_value);
+      }
+    } else {
+      return std::nullopt;
+    }
+  }
+};
+
+/**
+ * @brief Outcome of evaluating a boolean expression over all rows of a block
+ */
+enum class block_match {
+  NONE,  // No row evaluates to true
+  ALL,   // All rows evaluate to true
+  SOME   // Some rows may evaluate to true
+};
+
+/**
+ * @brief Evaluates an expression against the statistics of the columns of a block
+ */
+class block_evaluator {
+ public:
+  block_evaluator(std::unordered_map<ast::literal const*, column_block_stats> const& literals,
+                  host_span<column_block_stats const> columns,
+                  int64_t num_rows)
+    : _literals(literals), _columns(columns), _num_rows(num_rows)
+  {
+  }
+
+  /**
+   * @brief Evaluates a boolean expression over all rows of the block
+   */
+  [[nodiscard]] block_match evaluate(ast::expression const& expr) const
+  {
+    auto const op = dynamic_cast<ast::operation const*>(&expr);
+    if (op == nullptr) { return evaluate_boolean(values(expr)); }
+
+    auto const operands = op->get_operands();
+    switch (op->get_operator()) {
+      case ast::ast_operator::IDENTITY: return evaluate(operands[0]);
+      case ast::ast_operator::NOT:
+        // Rows that are not true may be null rather than false, so NOT of NONE is unknown
+        return (evaluate(operands[0]) == block_match::ALL) ? block_match::NONE : block_match::SOME;
+      case ast::ast_operator::LOGICAL_AND:
+      case ast::ast_operator::NULL_LOGICAL_AND: {
+        auto const lhs = evaluate(operands[0]);
+        auto const rhs = evaluate(operands[1]);
+        if (lhs == block_match::NONE || rhs == block_match::NONE) { return block_match::NONE; }
+        if (lhs == block_match::ALL && rhs == block_match::ALL) { return block_match::ALL; }
+        return block_match::SOME;
+      }
+      case ast::ast_operator::LOGICAL_OR:
+      case ast::ast_operator::NULL_LOGICAL_OR: {
+        auto const lhs = evaluate(operands[0]);
+        auto const rhs = evaluate(operands[1]);
+        if (lhs == block_match::NONE && rhs == block_match::NONE) { return block_match::NONE; }
+        // A null operand makes LOGICAL_OR null even if the other operand is true
+        auto const is_null_or = op->get_operator() == ast::ast_operator::NULL_LOGICAL_OR;
+        if ((lhs == block_match::ALL && rhs == block_match::ALL) ||
+            (is_null_or && (lhs == block_match::ALL || rhs == block_match::ALL))) {
+          return block_match::ALL;
+        }
+        return block_match::SOME;
+      }
+      case ast::ast_operator::EQUAL:
+      case ast::ast_operator::NULL_EQUAL:
+      case ast::ast_operator::NOT_EQUAL:
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::LESS_EQUAL:
+      case ast::ast_operator::GREATER_EQUAL: {
+        auto const lhs = values(operands[0]);
+        auto const rhs = values(operands[1]);
+        if (lhs == nullptr || rhs == nullptr) { return block_match::SOME; }
+        return compare(op->get_operator(), *lhs, *rhs);
+      }
+      default: return block_match::SOME;
+    }
+  }
+
+ private:
+  /**
+   * @brief Returns the statistics of the values of an expression; `nullptr` if unknown
+   */
+  [[nodiscard]] column_block_stats const* values(ast::expression const& expr) const
+  {
+    if (auto const lit = dynamic_cast<ast::literal const*>(&expr); lit != nullptr) {
+      auto const it = _literals.find(lit);
+      return (it != _literals.end()) ? &it->second : nullptr;
+    }
+    if (auto const col = dynamic_cast<ast::column_reference const*>(&expr); col != nullptr) {
+      if (col->get_table_source() != ast::table_reference::LEFT) { return nullptr; }
+      CUDF_EXPECTS(col->get_column_index() >= 0 &&
+                     static_cast<size_t>(col->get_column_index()) < _columns.size(),
+                   "Filter column index is out of range");
+      return &_columns[col->get_column_index()];
+    }
+    if (auto const op = dynamic_cast<ast::operation const*>(&expr);
+        op != nullptr && op->get_operator() == ast::ast_operator::IDENTITY) {
+      return values(op->get_operands()[0]);
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] bool may_have_nulls(column_block_stats const& stats) const
+  {
+    return not stats.null_count.has_value() || stats.null_count.value() > 0;
+  }
+
+  [[nodiscard]] bool is_all_nulls(column_block_stats const& stats) const
+  {
+    return stats.null_count.has_value() && stats.null_count.value() >= _num_rows;
+  }
+
+  /**
+   * @brief Evaluates a boolean column or literal over all rows of the block
+   */
+  [[nodiscard]] block_match evaluate_boolean(column_block_stats const* stats) const
+  {
+    if (stats == nullptr || stats->type.id() != type_id::BOOL8) { return block_match::SOME; }
+    if (is_all_nulls(*stats)) { return block_match::NONE; }
+    if (not stats->min.has_value() || not stats->max.has_value()) { return block_match::SOME; }
+    auto const false_value = column_block_stats::value_type{int64_t{0}};
+    if (stats->max.value() == false_value) { return block_match::NONE; }
+    if (stats->min.value() != false_value && not may_have_nulls(*stats)) {
+      return block_match::ALL;
+    }
+    return block_match::SOME;
+  }
+
+  /**
+   * @brief Evaluates a comparison over all rows of the block
+   */
+  [[nodiscard]] block_match compare(ast::ast_operator op,
+                                    column_block_stats const& lhs,
+                                    column_block_stats const& rhs) const
+  {
+    if (lhs.type.id() != type_id::EMPTY && rhs.type.id() != type_id::EMPTY) {
+      CUDF_EXPECTS(lhs.type == rhs.type, "Filter operands must have the same type");
+    }
+    auto const has_nulls = may_have_nulls(lhs) || may_have_nulls(rhs);
+    if (op == ast::ast_operator::NULL_EQUAL) {
+      // Null rows compare equal to each other
+      if (has_nulls) { return block_match::SOME; }
+      op = ast::ast_operator::EQUAL;
+    }
+    if (is_all_nulls(lhs) || is_all_nulls(rhs)) { return block_match::NONE; }
+    if (not lhs.min.has_value() || not lhs.max.has_value() || not rhs.min.has_value() ||
+        not rhs.max.has_value()) {
+      return block_match::SOME;
+    }
+
+    auto const& lmin = lhs.min.value();
+    auto const& lmax = lhs.max.value();
+    auto const& rmin = rhs.min.value();
+    auto const& rmax = rhs.max.value();
+    // NaN values are not part of floating-point ranges, and compare unequal to everything
+    auto const is_floating = std::holds_alternative<double>(lmin);
+    auto const result      = [&](bool none, bool all) {
+      if (none) { return block_match::NONE; }
+      return (all && not has_nulls && not is_floating) ? block_match::ALL : block_match::SOME;
+    };
+    auto const is_single_value = lmin == lmax && rmin == rmax && lmin == rmin;
+    switch (op) {
+      case ast::ast_operator::EQUAL: return result(lmax < rmin || rmax < lmin, is_single_value);
+      case ast::ast_operator::NOT_EQUAL:
+        return result(is_single_value && not is_floating, lmax < rmin || rmax < lmin);
+      case ast::ast_operator::LESS: return result(rmax <= lmin, lmax < rmin);
+      case ast::ast_operator::GREATER: return result(lmax <= rmin, rmax < lmin);
+      case ast::ast_operator::LESS_EQUAL: return result(rmax < lmin, lmax <= rmin);
+      case ast::ast_operator::GREATER_EQUAL: return result(lmax < rmin, rmax <= lmin);
+      default: return block_match::SOME;
+    }
+  }
+
+  std::unordered_map<ast::literal const*, column_block_stats> const& _literals;
+  host_span<column_block_stats const> _columns;
+  int64_t _num_rows;
+};
+
+/**
+ * @brief Copies the values of the valid literals of an expression to host and collects the
+ * referenced columns
+ */
+void collect_operands(ast::expression const& expr,
+                      std::unordered_map<ast::literal const*, column_block_stats>& literals,
+                      std::vector<size_type>& column_indices,
+                      rmm::cuda_stream_view stream)
+{
+  if (auto const col = dynamic_cast<ast::column_reference const*>(&expr); col != nullptr) {
+    if (col->get_table_source() == ast::table_reference::LEFT) {
+      column_indices.push_back(col->get_column_index());
+    }
+  } else if (auto const lit = dynamic_cast<ast::literal const*>(&expr); lit != nullptr) {
+    if (not lit->is_valid(stream)) { return; }
+    auto const value = type_dispatcher(
+      lit->get_data_type(), scalar_to_stats_value{}, lit->get_scalar(), stream);
+    if (value.has_value()) {
+      literals.emplace(lit, column_block_stats{lit->get_data_type(), value, value, 0});
+    }
+  } else if (auto const op = dynamic_cast<ast::operation const*>(&expr); op != nullptr) {
+    for (auto const& operand : op->get_operands()) {
+      collect_operands(operand.get(), literals, column_indices, stream);
+    }
+  }
+}
+
+}  // namespace
+
+stats_filter::stats_filter(ast::expression const& filter, rmm::cuda_stream_view stream)
+  : _filter(filter)
+{
+  collect_operands(_filter, _literals, _column_indices, stream);
+  std::sort(_column_indices.begin(), _column_indices.end());
+  _column_indices.erase(std::unique(_column_indices.begin(), _column_indices.end()),
+                        _column_indices.end());
+}
+
+bool stats_filter::may_contain_matches(host_span<column_block_stats const> columns,
+                                       int64_t num_rows) const
+{
+  return block_evaluator(_literals, columns, num_rows).evaluate(_filter) != block_match::NONE;
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Statistics of a column over a block of rows, such as a row group or a stripe
+ *
+ * The minimum and maximum are widened to the 64-bit type of the same kind as the column type:
+ * `int64_t` for signed integers, booleans, timestamps and durations, `uint64_t` for unsigned
+ * integers and `double` for floating-point types. Unset members are unknown.
+ */
+struct column_block_stats {
+  using value_type = std::variant<int64_t, uint64_t, double>;
+
+  data_type type{type_id::EMPTY};     // Type of the column
+  std::optional<value_type> min;      // Smallest non-null value
+  std::optional<value_type> max;      // Largest non-null value
+  std::optional<int64_t> null_count;  // Number of null values
+};
+
+/**
+ * @brief Filter that rules out blocks of rows based on the statistics of their columns
+ *
+ * The boolean filter expression is evaluated on the host against the range of values of each
+ * column of a block. A block is ruled out only if its statistics prove that no row evaluates to
+ * true; operators that cannot be evaluated on ranges of values are assumed to possibly match.
+ */
+class stats_filter {
+ public:
+  /**
+   * @brief Constructor from a filter expression.
+   *
+   * Column references of the expression are indices into the column statistics of a block.
+   *
+   * @param filter Boolean filter expression
+   * @param stream CUDA stream used to copy literal values to host
+   */
+  stats_filter(ast::expression const& filter, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether some rows of a block may satisfy the filter.
+   *
+   * @param columns Statistics of the columns of the block
+   * @param num_rows Number of rows in the block
+   *
+   * @return `false` if no row of the block can satisfy the filter
+   */
+  [[nodiscard]] bool may_contain_matches(host_span<column_block_stats const> columns,
+                                         int64_t num_rows) const;
+
+  /**
+   * @brief Returns the sorted indices of the columns referenced by the filter.
+   *
+   * Statistics of other columns are not used and do not need to be read.
+   */
+  [[nodiscard]] std::vector<size_type> const& get_column_indices() const
+  {
+    return _column_indices;
+  }
+
+ private:
+  ast::expression const& _filter;
+  // Host copy of the value of each valid literal with a supported type
+  std::unordered_map<ast::literal const*, column_block_stats> _literals;
+  std::vector<size_type> _column_indices;
+};
+
+}  // namespace cudf::io::detail
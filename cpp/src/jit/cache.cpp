@@ -14,13 +14,26 @@
  * limitations under the License.
  */
 
+#include <jit/cache.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/jit/kernel_cache.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <cuda.h>
 #include <jitify2.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 namespace cudf {
 namespace jit {
@@ -110,6 +123,57 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   return value != nullptr ? std::stoull(value) : default_val;
 }
 
+void trim_disk_cache(std::filesystem::path const& cache_dir, std::uintmax_t limit_bytes)
+{
+  static std::mutex trim_mutex{};
+  std::lock_guard<std::mutex> trim_lock(trim_mutex);
+
+  struct cache_file {
+    std::filesystem::path path;
+    std::uintmax_t size;
+    std::filesystem::file_time_type write_time;
+  };
+  std::vector<cache_file> files;
+  std::uintmax_t total_size = 0;
+  try {
+    for (auto const& entry : std::filesystem::directory_iterator(cache_dir)) {
+      std::error_code ec;
+      if (not entry.is_regular_file(ec)) { continue; }
+      auto const size       = entry.file_size(ec);
+      auto const write_time = entry.last_write_time(ec);
+      if (ec) { continue; }
+      files.push_back({entry.path(), size, write_time});
+      total_size += size;
+    }
+  } catch (std::filesystem::filesystem_error const&) {
+    return;
+  }
+  if (total_size <= limit_bytes) { return; }
+
+  std::sort(files.begin(), files.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.write_time < rhs.write_time;
+  });
+  for (auto const& file : files) {
+    if (total_size <= limit_bytes) { break; }
+    std::error_code ec;
+    if (std::filesystem::remove(file.path, ec)) { total_size -= file.size; }
+  }
+}
+
+/**
+ * @brief Removes the least recently written files of the disk cache, down to
+ * `LIBCUDF_KERNEL_CACHE_LIMIT_DISK_BYTES` bytes.
+ */
+void trim_disk_cache()
+{
+  static auto const limit_bytes =
+    try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK_BYTES", 0);
+  if (limit_bytes == 0) { return; }
+  auto const cache_dir = get_program_cache_dir();
+  if (cache_dir.empty()) { return; }
+  trim_disk_cache(cache_dir, limit_bytes);
+}
+
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
 {
   static std::mutex caches_mutex{};
@@ -134,10 +198,143 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
                      std::make_unique<jitify2::ProgramCache<>>(
                        kernel_limit_proc, preprog, nullptr, cache_dir, kernel_limit_disk)});
     existing_cache = res.first;
+    trim_disk_cache();
   }
 
   return *(existing_cache->second);
 }
 
+namespace {
+
+std::mutex statistics_mutex{};
+kernel_cache_statistics statistics{0, 0, std::chrono::nanoseconds{0}};
+std::unordered_set<std::size_t> loaded_kernels{};
+
+/**
+ * @brief Hash identifying a kernel instantiation within the process
+ */
+std::size_t kernel_key(kernel_instantiation const& kernel)
+{
+  std::string key = std::to_string(reinterpret_cast<std::uintptr_t>(kernel.cache));
+  key += '\0' + kernel.kernel_name;
+  // Sorted, so that the key does not depend on the order of the map
+  std::vector<std::string> headers;
+  for (auto const& [name, source] : kernel.header_sources) {
+    headers.push_back(name + '\0' + source);
+  }
+  std::sort(headers.begin(), headers.end());
+  for (auto const& header : headers) {
+    key += '\0' + header;
+  }
+  return std::hash<std::string>{}(key);
+}
+
+/**
+ * @brief Returns the kernel instantiation described by a manifest entry
+ */
+kernel_instantiation make_kernel_instantiation(udf_kernel_spec const& spec)
+{
+  switch (spec.kind) {
+    case udf_kernel_kind::BINARY_OPERATION:
+      CUDF_EXPECTS(spec.input_types.size() == 2, "Binary operations require two input types");
+      CUDF_EXPECTS(spec.is_ptx, "Binary operation UDFs must be PTX");
+      return binaryop_udf_kernel(
+        spec.udf, spec.output_type, spec.input_types[0], spec.input_types[1]);
+    case udf_kernel_kind::TRANSFORM:
+      CUDF_EXPECTS(spec.input_types.size() == 1, "Transforms require one input type");
+      return transform_udf_kernel(spec.udf, spec.is_ptx, spec.output_type, spec.input_types[0]);
+    case udf_kernel_kind::ROLLING_WINDOW: {
+      CUDF_EXPECTS(spec.input_types.size() == 1, "Rolling windows require one input type");
+      auto const agg = make_udf_aggregation<rolling_aggregation>(
+        spec.is_ptx ? udf_type::PTX : udf_type::CUDA, spec.udf, spec.output_type);
+      auto const& udf_agg = dynamic_cast<cudf::detail::udf_aggregation const&>(*agg);
+      // Window iterator types of the rolling window functions
+      switch (spec.window_type) {
+        case udf_window_type::FIXED:
+          return rolling_udf_kernel(
+            spec.input_types[0], udf_agg, "cudf::size_type", "cudf::size_type");
+        case udf_window_type::VARIABLE:
+          return rolling_udf_kernel(
+            spec.input_types[0], udf_agg, "cudf::size_type*", "cudf::size_type*");
+        case udf_window_type::GROUPED:
+          return rolling_udf_kernel(spec.input_types[0],
+                                    udf_agg,
+                                    "cudf::detail::preceding_window_wrapper",
+                                    "cudf::detail::following_window_wrapper");
+        default: CUDF_FAIL("Unsupported rolling window type");
+      }
+    }
+    default: CUDF_FAIL("Unsupported UDF kernel kind");
+  }
+}
+
+}  // namespace
+
+jitify2::Kernel get_kernel(kernel_instantiation const& kernel)
+{
+  auto const key       = kernel_key(kernel);
+  auto const is_loaded = [&] {
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    return loaded_kernels.count(key) != 0;
+  }();
+
+  auto const start = std::chrono::steady_clock::now();
+  auto result =
+    kernel.cache->get_kernel(kernel.kernel_name, {}, kernel.header_sources, {"-arch=sm_."});
+  auto const elapsed = std::chrono::steady_clock::now() - start;
+
+  {
+    std::lock_guard<std::mutex> lock(statistics_mutex);
+    if (is_loaded) {
+      ++statistics.hits;
+    } else {
+      ++statistics.misses;
+      statistics.compile_time += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+      loaded_kernels.insert(key);
+    }
+  }
+  // A kernel that was not loaded yet may have been added to the disk cache
+  if (not is_loaded) { trim_disk_cache(); }
+  return result;
+}
+
+void warmup_udf_kernels(std::vector<udf_kernel_spec> const& manifest, int num_threads)
+{
+  CUDF_FUNC_RANGE();
+  // Validate all entries before compiling
+  std::vector<kernel_instantiation> kernels;
+  std::transform(
+    manifest.cbegin(), manifest.cend(), std::back_inserter(kernels), make_kernel_instantiation);
+
+  if (num_threads <= 0) { num_threads = std::max(std::thread::hardware_concurrency(), 1u); }
+  num_threads = std::min<int>(num_threads, kernels.size());
+
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  std::atomic<std::size_t> next_kernel{0};
+  std::vector<std::future<void>> tasks;
+  for (int t = 0; t < num_threads; ++t) {
+    tasks.push_back(std::async(std::launch::async, [&] {
+      CUDF_CUDA_TRY(cudaSetDevice(device));
+      for (auto k = next_kernel++; k < kernels.size(); k = next_kernel++) {
+        get_kernel(kernels[k]);
+      }
+    }));
+  }
+  // Wait for all threads before rethrowing, as they reference the kernels
+  for (auto const& task : tasks) {
+    task.wait();
+  }
+  for (auto& task : tasks) {
+    task.get();
+  }
+}
+
+kernel_cache_statistics get_kernel_cache_statistics()
+{
+  std::lock_guard<std::mutex> lock(statistics_mutex);
+  return statistics;
+}
+
 }  // namespace jit
 }  // namespace cudf
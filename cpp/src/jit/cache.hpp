@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,13 +16,80 @@
 
 #pragma once
 
+#include <cudf/types.hpp>
+
 #include <jitify2.hpp>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace cudf {
+namespace detail {
+class udf_aggregation;
+}  // namespace detail
+
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Removes the least recently written files of a disk cache directory, down to the given
+ * total size.
+ *
+ * Files are removed on a best-effort basis, as other processes can share the cache directory.
+ *
+ * @param cache_dir Directory of the disk cache
+ * @param limit_bytes Maximum total size of the files in the directory
+ */
+void trim_disk_cache(std::filesystem::path const& cache_dir, std::uintmax_t limit_bytes);
+
+/**
+ * @brief Instantiation of a kernel of a cached program, with the UDF headers it is compiled with
+ */
+struct kernel_instantiation {
+  jitify2::ProgramCache<>* cache;  // Cache of the program of the kernel
+  std::string kernel_name;         // Name of the kernel template instantiation
+  std::unordered_map<std::string, std::string> header_sources;  // Generated UDF headers
+};
+
+/**
+ * @brief Returns a kernel from its program cache, compiling it if needed.
+ *
+ * Updates the counters of `get_kernel_cache_statistics`, and bounds the size of the disk cache
+ * after loading a kernel that was not loaded by the process yet.
+ */
+jitify2::Kernel get_kernel(kernel_instantiation const& kernel);
+
+/**
+ * @brief Returns the kernel of a `cudf::binary_operation` PTX UDF.
+ */
+kernel_instantiation binaryop_udf_kernel(std::string const& ptx,
+                                         data_type output_type,
+                                         data_type lhs_type,
+                                         data_type rhs_type);
+
+/**
+ * @brief Returns the kernel of a `cudf::transform` UDF.
+ */
+kernel_instantiation transform_udf_kernel(std::string const& udf,
+                                          bool is_ptx,
+                                          data_type output_type,
+                                          data_type input_type);
+
+/**
+ * @brief Returns the kernel of a rolling window UDF aggregation.
+ *
+ * @param input_type Type of the input column
+ * @param agg UDF aggregation
+ * @param preceding_window_str Type name of the preceding window iterator
+ * @param following_window_str Type name of the following window iterator
+ */
+kernel_instantiation rolling_udf_kernel(data_type input_type,
+                                        cudf::detail::udf_aggregation const& agg,
+                                        std::string const& preceding_window_str,
+                                        std::string const& following_window_str);
+
 }  // namespace jit
 }  // namespace cudf
@@ -19,9 +19,45 @@
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <jit_preprocessed_files/rolling/jit/kernel.cu.jit.hpp>
+
 #include <thrust/iterator/constant_iterator.h>
 
 namespace cudf {
+namespace jit {
+kernel_instantiation rolling_udf_kernel(data_type input_type,
+                                        cudf::detail::udf_aggregation const& agg,
+                                        std::string const& preceding_window_str,
+                                        std::string const& following_window_str)
+{
+  std::string cuda_source;
+  switch (agg.kind) {
+    case aggregation::Kind::PTX:
+      cuda_source += parse_single_function_ptx(agg._source,
+                                               agg._function_name,
+                                               get_type_name(agg._output_type),
+                                               {0, 5});  // args 0 and 5 are pointers.
+      break;
+    case aggregation::Kind::CUDA:
+      cuda_source += parse_single_function_cuda(agg._source, agg._function_name);
+      break;
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
+      .instantiate(get_type_name(input_type),  // list of template arguments
+                   get_type_name(agg._output_type),
+                   agg._operator_name,
+                   preceding_window_str.c_str(),
+                   following_window_str.c_str());
+
+  return {&get_program_cache(*rolling_jit_kernel_cu_jit),
+          std::move(kernel_name),
+          {{"rolling/jit/operation-udf.hpp", std::move(cuda_source)}}};
+}
+}  // namespace jit
+
 namespace detail {
 
 // Applies a fixed-size rolling window function to the values in a column.
@@ -48,8 +48,6 @@
 #include <jit/parser.hpp>
 #include <jit/type.hpp>
 
-#include <jit_preprocessed_files/rolling/jit/kernel.cu.jit.hpp>
-
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
@@ -1233,41 +1231,15 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   auto& udf_agg = dynamic_cast<udf_aggregation const&>(agg);
 
-  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg._source));
-
-  std::string cuda_source;
-  switch (udf_agg.kind) {
-    case aggregation::Kind::PTX:
-      cuda_source +=
-        cudf::jit::parse_single_function_ptx(udf_agg._source,
-                                             udf_agg._function_name,
-                                             cudf::jit::get_type_name(udf_agg._output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
-      break;
-    case aggregation::Kind::CUDA:
-      cuda_source += cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
-      break;
-    default: CUDF_FAIL("Unsupported UDF type.");
-  }
-
   std::unique_ptr<column> output = make_numeric_column(
     udf_agg._output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
 
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
-  std::string kernel_name =
-    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
-      .instantiate(cudf::jit::get_type_name(input.type()),  // list of template arguments
-                   cudf::jit::get_type_name(output->type()),
-                   udf_agg._operator_name,
-                   preceding_window_str.c_str(),
-                   following_window_str.c_str());
-
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+  cudf::jit::get_kernel(cudf::jit::rolling_udf_kernel(
+                          input.type(), udf_agg, preceding_window_str, following_window_str))
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
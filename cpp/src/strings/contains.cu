@@ -57,8 +57,7 @@ struct contains_fn {
 };
 
 std::unique_ptr<column> contains_impl(strings_column_view const& input,
-                                      std::string_view pattern,
-                                      regex_flags const flags,
+                                      regex_program const& prog,
                                       bool const beginning_only,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
@@ -71,7 +70,7 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                      mr);
   if (input.is_empty()) { return results; }
 
-  auto d_prog = reprog_device::create(pattern, flags, stream);
+  auto d_prog = reprog_device::create(prog, stream);
 
   auto d_results       = results->mutable_view().data<bool>();
   auto const d_strings = column_device_view::create(input.parent(), stream);
@@ -86,33 +85,30 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
 
 std::unique_ptr<column> contains_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_impl(input, pattern, flags, false, stream, mr);
+  return contains_impl(input, prog, false, stream, mr);
 }
 
 std::unique_ptr<column> matches_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_impl(input, pattern, flags, true, stream, mr);
+  return contains_impl(input, prog, true, stream, mr);
 }
 
 std::unique_ptr<column> count_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   // compile regex into device object
-  auto d_prog = reprog_device::create(pattern, flags, stream);
+  auto d_prog = reprog_device::create(prog, stream);
 
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
@@ -134,7 +130,16 @@ std::unique_ptr<column> contains_re(strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::contains_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> contains_re(strings_column_view const& strings,
+                                    regex_program const& prog,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> matches_re(strings_column_view const& strings,
@@ -143,7 +148,16 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::matches_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::matches_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> matches_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> count_re(strings_column_view const& strings,
@@ -152,7 +166,16 @@ std::unique_ptr<column> count_re(strings_column_view const& strings,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::count_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::count_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> count_re(strings_column_view const& strings,
+                                 regex_program const& prog,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <iterator>
 #include <numeric>
 #include <stack>
 #include <string>
@@ -129,6 +130,8 @@ void reprog::set_start_inst(int32_t id) { _startinst_id = id; }
 
 int32_t reprog::get_start_inst() const { return _startinst_id; }
 
+std::string const& reprog::prefilter() const { return _prefilter; }
+
 int32_t reprog::insts_count() const { return static_cast<int>(_insts.size()); }
 
 int32_t reprog::classes_count() const { return static_cast<int>(_classes.size()); }
@@ -877,6 +880,7 @@ void reprog::finalize()
 {
   collapse_nops();
   build_start_ids();
+  build_prefilter();
 }
 
 void reprog::collapse_nops()
@@ -952,6 +956,98 @@ void reprog::build_start_ids()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+/**
+ * @brief Find the longest literal that every match of the program contains.
+ *
+ * A CHAR instruction is on every match if removing it disconnects END from the start
+ * instruction. The literal then continues with the CHAR instructions that follow it,
+ * skipping the zero-width instructions that do not branch. For example, the pattern
+ * `.*ERROR \d+` produces the literal `ERROR `.
+ *
+ * Each sequence of CHAR instructions is only walked from its first CHAR. Since a CHAR is always
+ * followed by the next one, the required CHARs of a sequence are at its end.
+ *
+ * Instructions matching the NUL character are not included, since the end of the string is
+ * evaluated as a NUL character.
+ */
+void reprog::build_prefilter()
+{
+  _prefilter.clear();
+  auto const count = insts_count();
+
+  // returns true if every path from the start instruction to END goes through `id`
+  auto const is_required = [&](int32_t id) {
+    if (id == _startinst_id) { return true; }
+    std::vector<bool> visited(count, false);
+    std::stack<int32_t> ids;
+    ids.push(_startinst_id);
+    visited[_startinst_id] = true;
+    while (!ids.empty()) {
+      auto const& inst = _insts[ids.top()];
+      ids.pop();
+      if (inst.type == END) { return false; }
+      auto const visit = [&](int32_t next_id) {
+        if (next_id != id && next_id >= 0 && next_id < count && !visited[next_id]) {
+          visited[next_id] = true;
+          ids.push(next_id);
+        }
+      };
+      visit(inst.u2.next_id);
+      if (inst.type == OR) { visit(inst.u1.right_id); }
+    }
+    return true;
+  };
+
+  auto const is_literal = [&](int32_t id) {
+    return id >= 0 && id < count && _insts[id].type == CHAR && _insts[id].u1.c != 0;
+  };
+  auto const is_zero_width = [&](int32_t id) {
+    auto const type = _insts[id].type;
+    return type == LBRA || type == RBRA || type == BOL || type == EOL || type == BOW ||
+           type == NBOW;
+  };
+
+  // returns the instruction after `id`, skipping the zero-width instructions
+  auto const next_literal = [&](int32_t id) {
+    auto next_id = _insts[id].u2.next_id;
+    while (next_id >= 0 && next_id < count && is_zero_width(next_id)) {
+      next_id = _insts[next_id].u2.next_id;
+    }
+    return next_id;
+  };
+
+  // a CHAR that follows another CHAR is part of the literal of the first one
+  std::vector<bool> is_continued(count, false);
+  for (int32_t id = 0; id < count; ++id) {
+    if (!is_literal(id)) { continue; }
+    auto const next_id = next_literal(id);
+    if (is_literal(next_id)) { is_continued[next_id] = true; }
+  }
+
+  std::vector<int32_t> best;
+  for (int32_t id = 0; id < count; ++id) {
+    if (!is_literal(id) || is_continued[id]) { continue; }
+    std::vector<int32_t> ids;
+    auto next_id = id;
+    while (is_literal(next_id) && static_cast<int32_t>(ids.size()) < count) {
+      ids.push_back(next_id);
+      next_id = next_literal(next_id);
+    }
+    // A CHAR is always followed by the next one, so the required CHARs end the literal.
+    // Find the first one with a binary search.
+    auto const first = std::partition_point(
+      ids.begin(), ids.end(), [&](int32_t literal_id) { return !is_required(literal_id); });
+    if (std::distance(first, ids.end()) > static_cast<std::ptrdiff_t>(best.size())) {
+      best.assign(first, ids.end());
+    }
+  }
+
+  for (auto const id : best) {
+    char buffer[4];
+    _prefilter.append(buffer, from_char_utf8(_insts[id].u1.c, buffer));
+  }
+}
+
 /**
  * @brief Check a specific instruction for errors.
  *
@@ -1073,6 +1169,7 @@ void reprog::print(regex_flags const flags)
   }
 
   printf("startinst_id=%d\n", _startinst_id);
+  if (!_prefilter.empty()) { printf("prefilter='%s'\n", _prefilter.c_str()); }
   if (_startinst_ids.size() > 0) {
     printf("startinst_ids: [");
     for (size_t i = 0; i < _startinst_ids.size(); i++) {
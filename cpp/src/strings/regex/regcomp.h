@@ -134,6 +134,14 @@ class reprog {
   void set_start_inst(int32_t id);
   [[nodiscard]] int32_t get_start_inst() const;
 
+  /**
+   * @brief Returns a literal string that every match of the program contains
+   *
+   * Strings not containing it can be skipped without evaluating the instructions.
+   * The literal is encoded as UTF-8 and is empty if the analysis did not find one.
+   */
+  [[nodiscard]] std::string const& prefilter() const;
+
   void finalize();
   void check_for_errors();
 #ifndef NDEBUG
@@ -146,10 +154,12 @@ class reprog {
   int32_t _startinst_id{};              // id of first instruction
   std::vector<int32_t> _startinst_ids;  // short-cut to speed-up ORs
   int32_t _num_capturing_groups{};
+  std::string _prefilter;               // literal included in every match
 
   reprog() = default;
   void collapse_nops();
   void build_start_ids();
+  void build_prefilter();
   void check_for_errors(int32_t id, int32_t next_id);
 };
 
@@ -18,6 +18,7 @@
 #include <strings/regex/regcomp.h>
 
 #include <cudf/strings/regex/flags.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -78,28 +79,14 @@ class reprog_device {
   reprog_device& operator=(reprog_device&&) = default;
 
   /**
-   * @brief Create device program instance from a regex pattern.
+   * @brief Create the device program instance from a compiled regex program.
    *
-   * The number of strings is needed to compute the state data size required when evaluating the
-   * regex.
-   *
-   * @param pattern The regex pattern to compile.
-   * @param stream CUDA stream used for device memory operations and kernel launches.
-   * @return The program device object.
-   */
-  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
-    std::string_view pattern, rmm::cuda_stream_view stream);
-
-  /**
-   * @brief Create the device program instance from a regex pattern.
-   *
-   * @param pattern The regex pattern to compile.
-   * @param re_flags Regex flags for interpreting special characters in the pattern.
+   * @param prog The regex program to copy to the device.
    * @param stream CUDA stream used for device memory operations and kernel launches
    * @return The program device object.
    */
   static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
-    std::string_view pattern, regex_flags const re_flags, rmm::cuda_stream_view stream);
+    regex_program const& prog, rmm::cuda_stream_view stream);
 
   /**
    * @brief Called automatically by the unique_ptr returned from create().
@@ -266,7 +253,7 @@ class reprog_device {
                                          cudf::size_type& end,
                                          cudf::size_type const group_id = 0) const;
 
-  reprog_device(reprog&);
+  reprog_device(reprog const&);
 
   int32_t _startinst_id;          // first instruction id
   int32_t _num_capturing_groups;  // instruction groups
@@ -279,6 +266,8 @@ class reprog_device {
   reinst const* _insts{};             // array of regex instructions
   int32_t const* _startinst_ids{};    // array of start instruction ids
   reclass_device const* _classes{};   // array of regex classes
+  char const* _prefilter{};           // literal included in every match
+  cudf::size_type _prefilter_size{};  // size of the literal in bytes; 0 if none
 
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
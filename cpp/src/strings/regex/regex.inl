@@ -424,6 +424,12 @@ __device__ __forceinline__ int32_t reprog_device::call_regexec(int32_t const thr
   gp_ptr += relist::alloc_size(_max_insts, _thread_count);
   relist list2(static_cast<int16_t>(_max_insts), _thread_count, gp_ptr, thread_idx);
 
+  // a string without the literal included in every match cannot match
+  if ((_prefilter_size > 0) &&
+      (dstr.find(_prefilter, _prefilter_size, std::max(begin, 0)) < 0)) {
+    return 0;
+  }
+
   reljunk jnk(&list1, &list2, get_inst(_startinst_id));
   return regexec(dstr, jnk, begin, end, group_id);
 }
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/regex/regcomp.h>
+#include <strings/regex/regex_program_impl.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace strings {
+namespace {
+
+/**
+ * @brief Cache of the most recently used compiled programs, keyed by pattern and flags.
+ */
+class reprog_cache {
+ public:
+  explicit reprog_cache(std::size_t capacity) : _capacity{capacity} {}
+
+  /**
+   * @brief Returns the cached program of the pattern and flags, compiling it on a miss.
+   */
+  std::shared_ptr<detail::reprog const> get_or_compile(std::string_view pattern,
+                                                       regex_flags const flags)
+  {
+    if (_capacity == 0) { return compile(pattern, flags); }
+
+    key_type key{std::string{pattern}, flags};
+    if (auto prog = lookup(key); prog) { return prog; }
+
+    // compile outside of the lock; concurrent misses of a pattern may both compile it
+    auto prog = compile(pattern, flags);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _index.find(key);
+    if (it != _index.end()) { return touch(it->second); }
+    _entries.emplace_front(key, prog);
+    _index.emplace(std::move(key), _entries.begin());
+    if (_entries.size() > _capacity) {
+      _index.erase(_entries.back().first);
+      _entries.pop_back();
+    }
+    return prog;
+  }
+
+ private:
+  using key_type   = std::pair<std::string, regex_flags>;
+  using entry_type = std::pair<key_type, std::shared_ptr<detail::reprog const>>;
+
+  struct key_hash {
+    std::size_t operator()(key_type const& key) const
+    {
+      return std::hash<std::string>{}(key.first) * 31 + static_cast<std::size_t>(key.second);
+    }
+  };
+
+  static std::shared_ptr<detail::reprog const> compile(std::string_view pattern,
+                                                       regex_flags const flags)
+  {
+    return std::make_shared<detail::reprog const>(detail::reprog::create_from(pattern, flags));
+  }
+
+  std::shared_ptr<detail::reprog const> lookup(key_type const& key)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _index.find(key);
+    return it != _index.end() ? touch(it->second) : nullptr;
+  }
+
+  // Moves an entry to the front of the list of most recently used entries
+  std::shared_ptr<detail::reprog const> touch(std::list<entry_type>::iterator entry)
+  {
+    _entries.splice(_entries.begin(), _entries, entry);
+    return entry->second;
+  }
+
+  std::size_t const _capacity;
+  std::mutex _mutex;
+  std::list<entry_type> _entries;  // most recently used first
+  std::unordered_map<key_type, std::list<entry_type>::iterator, key_hash> _index;
+};
+
+reprog_cache& get_reprog_cache()
+{
+  static reprog_cache cache{[]() -> std::size_t {
+    auto const value = std::getenv("LIBCUDF_REGEX_PROGRAM_CACHE_SIZE");
+    if (value == nullptr) { return 128; }
+    std::string_view const digits{value};
+    auto const is_digit = [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; };
+    CUDF_EXPECTS(not digits.empty() and std::all_of(digits.begin(), digits.end(), is_digit),
+                 "LIBCUDF_REGEX_PROGRAM_CACHE_SIZE must be a number of programs");
+    return std::strtoull(value, nullptr, 10);
+  }()};
+  return cache;
+}
+
+}  // namespace
+
+std::unique_ptr<regex_program> regex_program::create(std::string_view pattern,
+                                                     regex_flags flags)
+{
+  return std::unique_ptr<regex_program>(new regex_program(pattern, flags));
+}
+
+regex_program::regex_program(std::string_view pattern, regex_flags flags)
+  : _pattern(pattern),
+    _flags(flags),
+    _impl(std::make_unique<regex_program_impl>(
+      regex_program_impl{get_reprog_cache().get_or_compile(pattern, flags)}))
+{
+}
+
+regex_program::regex_program(regex_program&& other) noexcept = default;
+
+regex_program& regex_program::operator=(regex_program&& other) noexcept = default;
+
+regex_program::~regex_program() = default;
+
+std::string regex_program::pattern() const { return _pattern; }
+
+regex_flags regex_program::flags() const { return _flags; }
+
+int32_t regex_program::instructions_count() const { return _impl->prog->insts_count(); }
+
+int32_t regex_program::groups_count() const { return _impl->prog->groups_count(); }
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <strings/regex/regcomp.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @brief Implementation object of a `regex_program`.
+ *
+ * The compiled program is shared with the program cache and with the other `regex_program`
+ * instances created from the same pattern and flags.
+ */
+struct regex_program::regex_program_impl {
+  std::shared_ptr<detail::reprog const> prog;
+};
+
+/**
+ * @brief Gives the device program builder access to the compiled program.
+ */
+struct regex_device_builder {
+  static detail::reprog const& get_reprog(regex_program const& program)
+  {
+    return *program._impl->prog;
+  }
+};
+
+}  // namespace strings
+}  // namespace cudf
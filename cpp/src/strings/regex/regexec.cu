@@ -16,6 +16,7 @@
 
 #include <strings/regex/regcomp.h>
 #include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/utilities.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
@@ -33,7 +34,7 @@ namespace strings {
 namespace detail {
 
 // Copy reprog primitive values
-reprog_device::reprog_device(reprog& prog)
+reprog_device::reprog_device(reprog const& prog)
   : _startinst_id{prog.get_start_inst()},
     _num_capturing_groups{prog.groups_count()},
     _insts_count{prog.insts_count()},
@@ -44,18 +45,12 @@ reprog_device::reprog_device(reprog& prog)
 {
 }
 
-std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
-  std::string_view pattern, rmm::cuda_stream_view stream)
-{
-  return reprog_device::create(pattern, regex_flags::MULTILINE, stream);
-}
-
 // Create instance of the reprog that can be passed into a device kernel
 std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
-  std::string_view pattern, regex_flags const flags, rmm::cuda_stream_view stream)
+  regex_program const& prog, rmm::cuda_stream_view stream)
 {
-  // compile pattern into host object
-  reprog h_prog = reprog::create_from(pattern, flags);
+  // the host program compiled from the pattern
+  reprog const& h_prog = regex_device_builder::get_reprog(prog);
 
   // compute size to hold all the member data
   auto const insts_count   = h_prog.insts_count();
@@ -72,9 +67,12 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     std::plus<std::size_t>{},
     [&h_prog](auto& cls) { return cls.literals.size() * sizeof(reclass_range); });
   // make sure each section is aligned for the subsequent section's data type
-  auto const memsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
-                       cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
-                       cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+  auto const progsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
+                        cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
+                        cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+  // the prefilter literal is placed last and is not copied to shared memory
+  auto const& prefilter = h_prog.prefilter();
+  auto const memsize    = progsize + prefilter.size();
 
   // allocate memory to store all the prog data in a flat contiguous buffer
   std::vector<u_char> h_buffer(memsize);                        // copy everything into here;
@@ -109,7 +107,7 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
   auto d_end = d_ptr + (classes_count * sizeof(reclass_device));
   // place each class and append the variable length data
   for (int32_t idx = 0; idx < classes_count; ++idx) {
-    auto const& h_class = h_prog.class_at(idx);
+    auto const& h_class = h_prog.classes_data()[idx];
     reclass_device d_class{h_class.builtins,
                            static_cast<int32_t>(h_class.literals.size()),
                            reinterpret_cast<reclass_range*>(d_end)};
@@ -119,9 +117,15 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     d_end += h_class.literals.size() * sizeof(reclass_range);
   }
 
+  // copy the prefilter literal at the end
+  memcpy(h_buffer.data() + progsize, prefilter.data(), prefilter.size());
+  d_prog->_prefilter =
+    prefilter.empty() ? nullptr : reinterpret_cast<char const*>(d_buffer->data()) + progsize;
+  d_prog->_prefilter_size = static_cast<cudf::size_type>(prefilter.size());
+
   // initialize the rest of the elements
   d_prog->_max_insts = insts_count;
-  d_prog->_prog_size = memsize + sizeof(reprog_device);
+  d_prog->_prog_size = progsize + sizeof(reprog_device);
 
   // copy flat prog to device memory
   CUDF_CUDA_TRY(cudaMemcpyAsync(
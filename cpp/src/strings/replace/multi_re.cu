@@ -144,7 +144,7 @@ std::unique_ptr<column> replace_re(
     patterns.size());
   std::transform(
     patterns.begin(), patterns.end(), h_progs.begin(), [flags, stream](auto const& ptn) {
-      return reprog_device::create(ptn, flags, stream);
+      return reprog_device::create(*regex_program::create(ptn, flags), stream);
     });
 
   // get the longest regex for the dispatcher
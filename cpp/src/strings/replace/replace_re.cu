@@ -102,10 +102,9 @@ struct replace_regex_fn {
 //
 std::unique_ptr<column> replace_re(
   strings_column_view const& input,
-  std::string_view pattern,
+  regex_program const& prog,
   string_scalar const& replacement,
   std::optional<size_type> max_replace_count,
-  regex_flags const flags,
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -115,7 +114,7 @@ std::unique_ptr<column> replace_re(
   string_view d_repl(replacement.data(), replacement.size());
 
   // compile regex into device object
-  auto d_prog = reprog_device::create(pattern, flags, stream);
+  auto d_prog = reprog_device::create(prog, stream);
 
   auto const maxrepl = max_replace_count.value_or(-1);
 
@@ -143,8 +142,20 @@ std::unique_ptr<column> replace_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  auto const h_prog = regex_program::create(pattern, flags);
   return detail::replace_re(
-    strings, pattern, replacement, max_replace_count, flags, cudf::default_stream_value, mr);
+    strings, *h_prog, replacement, max_replace_count, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> replace_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   string_scalar const& replacement,
+                                   std::optional<size_type> max_replace_count,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_re(
+    strings, prog, replacement, max_replace_count, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
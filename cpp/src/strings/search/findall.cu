@@ -87,15 +87,14 @@ struct findall_fn {
 }  // namespace
 
 std::unique_ptr<table> findall(strings_column_view const& input,
-                               std::string_view pattern,
-                               regex_flags const flags,
+                               regex_program const& prog,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   auto const strings_count = input.size();
 
   // compile regex into device object
-  auto const d_prog = reprog_device::create(pattern, flags, stream);
+  auto const d_prog = reprog_device::create(prog, stream);
 
   auto const d_strings = column_device_view::create(input.parent(), stream);
   auto find_counts     = count_matches(*d_strings, *d_prog, strings_count, stream);
@@ -153,7 +152,16 @@ std::unique_ptr<table> findall(strings_column_view const& input,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall(input, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::findall(input, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<table> findall(strings_column_view const& input,
+                               regex_program const& prog,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall(input, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -94,8 +94,7 @@ std::unique_ptr<column> findall_util(column_device_view const& d_strings,
 //
 std::unique_ptr<column> findall_record(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -103,7 +102,7 @@ std::unique_ptr<column> findall_record(
   auto const d_strings     = column_device_view::create(input.parent(), stream);
 
   // compile regex into device object
-  auto const d_prog = reprog_device::create(pattern, flags, stream);
+  auto const d_prog = reprog_device::create(prog, stream);
 
   // Create lists offsets column
   auto offsets   = count_matches(*d_strings, *d_prog, strings_count + 1, stream, mr);
@@ -139,7 +138,16 @@ std::unique_ptr<column> findall_record(strings_column_view const& input,
                                        rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall_record(input, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::findall_record(input, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> findall_record(strings_column_view const& input,
+                                       regex_program const& prog,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_record(input, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
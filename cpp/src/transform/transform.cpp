@@ -32,6 +32,31 @@
 #include <rmm/cuda_stream_view.hpp>
 
 namespace cudf {
+namespace jit {
+kernel_instantiation transform_udf_kernel(std::string const& udf,
+                                          bool is_ptx,
+                                          data_type output_type,
+                                          data_type input_type)
+{
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::kernel")  //
+      .instantiate(get_type_name(output_type),  // list of template arguments
+                   get_type_name(input_type));
+
+  std::string cuda_source =
+    is_ptx ? parse_single_function_ptx(udf,  //
+                                       "GENERIC_UNARY_OP",
+                                       get_type_name(output_type),
+                                       {0})
+           : parse_single_function_cuda(udf,  //
+                                        "GENERIC_UNARY_OP");
+
+  return {&get_program_cache(*transform_jit_kernel_cu_jit),
+          std::move(kernel_name),
+          {{"transform/jit/operation-udf.hpp", std::move(cuda_source)}}};
+}
+}  // namespace jit
+
 namespace transformation {
 namespace jit {
 
@@ -42,24 +67,10 @@ void unary_operation(mutable_column_view output,
                      bool is_ptx,
                      rmm::cuda_stream_view stream)
 {
-  std::string kernel_name =
-    jitify2::reflection::Template("cudf::transformation::jit::kernel")  //
-      .instantiate(cudf::jit::get_type_name(output.type()),  // list of template arguments
-                   cudf::jit::get_type_name(input.type()));
-
-  std::string cuda_source =
-    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
-                                                  "GENERIC_UNARY_OP",
-                                                  cudf::jit::get_type_name(output_type),
-                                                  {0})
-           : cudf::jit::parse_single_function_cuda(udf,  //
-                                                   "GENERIC_UNARY_OP");
-
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+  cudf::jit::get_kernel(
+    cudf::jit::transform_udf_kernel(udf, is_ptx, output_type, input.type()))  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                     //
+    ->launch(output.size(),                                                   //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
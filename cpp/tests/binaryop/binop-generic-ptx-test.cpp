@@ -17,12 +17,21 @@
  * limitations under the License.
  */
 
+#include <cudf_test/file_utilities.hpp>
+
 #include <cudf/binaryop.hpp>
+#include <cudf/jit/kernel_cache.hpp>
 
+#include <jit/cache.hpp>
 #include <tests/binaryop/assert-binops.h>
 #include <tests/binaryop/binop-fixture.hpp>
 #include <tests/binaryop/util/runtime_support.h>
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
 namespace cudf {
 namespace test {
 namespace binop {
@@ -32,12 +41,9 @@ struct BinaryOperationGenericPTXTest : public BinaryOperationTest {
   {
     if (!can_do_runtime_jit()) { GTEST_SKIP() << "Skipping tests that require 11.5 runtime"; }
   }
-};
 
-TEST_F(BinaryOperationGenericPTXTest, CAdd_Vector_Vector_FP32_FP32_FP32)
-{
-  // c = a*a*a + b
-  const char* ptx =
+  // c = a*a*a + b, with FP32 inputs and output
+  static constexpr char const* fp32_cadd_ptx =
     R"***(
 //
 // Generated by NVIDIA NVVM Compiler
@@ -77,7 +83,10 @@ TEST_F(BinaryOperationGenericPTXTest, CAdd_Vector_Vector_FP32_FP32_FP32)
 	ret;
 }
 )***";
+};
 
+TEST_F(BinaryOperationGenericPTXTest, CAdd_Vector_Vector_FP32_FP32_FP32)
+{
   using TypeOut = float;
   using TypeLhs = float;
   using TypeRhs = float;
@@ -87,7 +96,7 @@ TEST_F(BinaryOperationGenericPTXTest, CAdd_Vector_Vector_FP32_FP32_FP32)
   auto lhs = make_random_wrapped_column<TypeLhs>(500);
   auto rhs = make_random_wrapped_column<TypeRhs>(500);
 
-  auto out = cudf::binary_operation(lhs, rhs, ptx, data_type(type_to_id<TypeOut>()));
+  auto out = cudf::binary_operation(lhs, rhs, fp32_cadd_ptx, data_type(type_to_id<TypeOut>()));
 
   // pow has a max ULP error of 2 per CUDA programming guide
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, CADD, NearEqualComparator<TypeOut>{2});
@@ -213,6 +222,78 @@ TEST_F(BinaryOperationGenericPTXTest, CAdd_Vector_Vector_INT64_INT32_INT64)
   ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, CADD);
 }
 
+TEST_F(BinaryOperationGenericPTXTest, WarmupKernelCache)
+{
+  using TypeOut = float;
+  using TypeLhs = float;
+  using TypeRhs = float;
+
+  auto const float_type = data_type(type_to_id<TypeOut>());
+  cudf::jit::udf_kernel_spec const spec{cudf::jit::udf_kernel_kind::BINARY_OPERATION,
+                                        fp32_cadd_ptx,
+                                        true,
+                                        float_type,
+                                        {float_type, float_type}};
+
+  // The kernel is a hit if an earlier test already loaded it
+  auto const before = cudf::jit::get_kernel_cache_statistics();
+  cudf::jit::warmup_udf_kernels({spec});
+  auto const warm = cudf::jit::get_kernel_cache_statistics();
+  EXPECT_EQ(warm.hits + warm.misses, before.hits + before.misses + 1);
+
+  auto CADD = [](TypeLhs a, TypeRhs b) { return a * a * a + b; };
+
+  auto lhs = make_random_wrapped_column<TypeLhs>(500);
+  auto rhs = make_random_wrapped_column<TypeRhs>(500);
+
+  auto out         = cudf::binary_operation(lhs, rhs, fp32_cadd_ptx, float_type);
+  auto const after = cudf::jit::get_kernel_cache_statistics();
+  EXPECT_EQ(after.hits, warm.hits + 1);
+  EXPECT_EQ(after.misses, warm.misses);
+
+  ASSERT_BINOP<TypeOut, TypeLhs, TypeRhs>(*out, lhs, rhs, CADD, NearEqualComparator<TypeOut>{2});
+
+  auto const missing_input = cudf::jit::udf_kernel_spec{
+    cudf::jit::udf_kernel_kind::BINARY_OPERATION, fp32_cadd_ptx, true, float_type, {float_type}};
+  EXPECT_THROW(cudf::jit::warmup_udf_kernels({missing_input}), cudf::logic_error);
+}
+
+struct KernelDiskCacheTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(KernelDiskCacheTest, TrimToByteLimit)
+{
+  cudf::test::temp_directory const temp_dir("kernel_cache_test");
+  std::filesystem::path const cache_dir(temp_dir.path());
+
+  // Five 1KB cache files, written one second apart
+  auto const now = std::filesystem::file_time_type::clock::now();
+  for (int i = 0; i < 5; ++i) {
+    auto const path = cache_dir / ("kernel_" + std::to_string(i));
+    std::ofstream(path) << std::string(1024, 'x');
+    std::filesystem::last_write_time(path, now - std::chrono::seconds(5 - i));
+  }
+  auto const num_files = [&] {
+    auto const files = std::filesystem::directory_iterator(cache_dir);
+    return std::distance(begin(files), end(files));
+  };
+
+  // Nothing is removed while the files fit
+  cudf::jit::trim_disk_cache(cache_dir, 5 * 1024);
+  EXPECT_EQ(num_files(), 5);
+
+  // The oldest files are removed first, until the others fit
+  cudf::jit::trim_disk_cache(cache_dir, 2 * 1024 + 100);
+  EXPECT_EQ(num_files(), 2);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(std::filesystem::exists(cache_dir / ("kernel_" + std::to_string(i))), i >= 3);
+  }
+
+  // A limit below the size of any file empties the cache
+  cudf::jit::trim_disk_cache(cache_dir, 1);
+  EXPECT_EQ(num_files(), 0);
+}
+
 }  // namespace binop
 }  // namespace test
 }  // namespace cudf
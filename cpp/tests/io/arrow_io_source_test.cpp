@@ -30,6 +30,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Global environment for temporary files
 auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
@@ -61,6 +62,53 @@ TEST_F(ArrowIOTest, URIFileSystem)
   ASSERT_EQ(2, tbl.tbl->num_rows());
 }
 
+TEST_F(ArrowIOTest, HostReadRanges)
+{
+  const std::string file_name = temp_env->get_temp_dir() + "HostReadRanges.bin";
+  std::string contents;
+  for (int i = 0; i < 1 << 20; ++i) {
+    contents.push_back(static_cast<char>(i % 251));
+  }
+  std::ofstream outfile(file_name, std::ofstream::out | std::ofstream::binary);
+  outfile << contents;
+  outfile.close();
+
+  auto datasource = std::make_unique<cudf::io::arrow_io_source>("file://" + file_name);
+
+  // Unsorted, overlapping, adjacent and distant ranges, and a range past the end of the file
+  std::vector<cudf::io::datasource::read_range> const ranges{{1000, 100},
+                                                             {0, 10},
+                                                             {1050, 200},
+                                                             {1250, 5},
+                                                             {900 * 1024, 1024},
+                                                             {contents.size() - 8, 16}};
+  auto const buffers = datasource->host_read_ranges(ranges);
+  ASSERT_EQ(buffers.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto const expected = contents.substr(ranges[i].offset, ranges[i].size);
+    ASSERT_EQ(buffers[i]->size(), expected.size());
+    EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffers[i]->data()), buffers[i]->size()),
+              expected);
+  }
+}
+
+TEST_F(ArrowIOTest, HostReadAsync)
+{
+  const std::string file_name = temp_env->get_temp_dir() + "HostReadAsync.txt";
+  std::ofstream outfile(file_name, std::ofstream::out);
+  outfile << "0123456789abcdef";
+  outfile.close();
+
+  auto datasource = std::make_unique<cudf::io::arrow_io_source>("file://" + file_name);
+
+  auto first  = datasource->host_read_async(2, 4);
+  auto second = datasource->host_read_async(12, 8);
+  auto buffer = first.get();
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffer->data()), buffer->size()), "2345");
+  buffer = second.get();
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(buffer->data()), buffer->size()), "cdef");
+}
+
 #ifdef S3_ENABLED
 
 TEST_F(ArrowIOTest, S3FileSystem)
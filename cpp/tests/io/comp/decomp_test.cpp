@@ -15,8 +15,11 @@
  */
 
 #include <io/comp/gpuinflate.hpp>
+#include <io/comp/io_uncomp.hpp>
+#include <io/comp/unbz2.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
+#include <cudf/io/datasource.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -24,6 +27,8 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <cstring>
+#include <string>
 #include <vector>
 
 using cudf::device_span;
@@ -166,4 +171,192 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+/**
+ * @brief Test fixture for batched host decompression
+ */
+struct HostDecompressTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(HostDecompressTest, BatchedBlocks)
+{
+  constexpr char uncompressed[]       = "hello world";
+  constexpr uint8_t gzip_compressed[] = {
+    0x1f, 0x8b, 0x8,  0x0,  0x9,  0x63, 0x99, 0x5c, 0x2,  0xff, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+    0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,  0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+  constexpr uint8_t snappy_compressed[] = {
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  auto test_batch = [&](cudf::io::compression_type compression, auto const& compressed) {
+    constexpr size_t num_blocks = 100;
+    std::vector<uint8_t> output(num_blocks * sizeof(uncompressed));
+    std::vector<cudf::host_span<uint8_t const>> srcs(num_blocks, {compressed, sizeof(compressed)});
+    std::vector<cudf::host_span<uint8_t>> dsts;
+    for (size_t i = 0; i < num_blocks; ++i) {
+      dsts.emplace_back(output.data() + i * sizeof(uncompressed), sizeof(uncompressed));
+    }
+
+    auto const sizes = cudf::io::decompress(compression, srcs, dsts, cudf::default_stream_value);
+    ASSERT_EQ(sizes.size(), num_blocks);
+    for (size_t i = 0; i < num_blocks; ++i) {
+      ASSERT_EQ(sizes[i], strlen(uncompressed));
+      EXPECT_EQ(std::string(reinterpret_cast<char const*>(dsts[i].data()), sizes[i]),
+                uncompressed);
+    }
+  };
+  test_batch(cudf::io::compression_type::GZIP, gzip_compressed);
+  test_batch(cudf::io::compression_type::SNAPPY, snappy_compressed);
+}
+
+TEST_F(HostDecompressTest, Bzip2ParallelBlocks)
+{
+  // 120000 lines of "<i % 10>\n", compressed with 100k blocks (three blocks)
+  constexpr uint8_t compressed[] = {
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x27, 0x38, 0x8f, 0x37, 0x0, 0x61,
+    0xa3, 0x48, 0x0, 0x0, 0x10, 0x7f, 0xe0, 0x20, 0x0, 0x70, 0x40, 0x34, 0xd3, 0x40, 0x52, 0xa8,
+    0x34, 0x69, 0xea, 0x65, 0x41, 0x51, 0xcd, 0x41, 0x51, 0xd5, 0x41, 0x51, 0xdd, 0x41, 0x51, 0xaa,
+    0x82, 0xa3, 0xca, 0x82, 0xa3, 0xda, 0x82, 0xa3, 0x75, 0x5, 0x47, 0xd5, 0x5, 0x46, 0x54, 0x15,
+    0x1b, 0xc5, 0x9, 0x41, 0x7e, 0x62, 0x82, 0xb2, 0x4c, 0xa6, 0xb3, 0xb1, 0xc5, 0x1e, 0xd2, 0x0,
+    0x27, 0xe, 0x90, 0x0, 0x0, 0x20, 0xff, 0xc0, 0x40, 0x0, 0xe0, 0x80, 0x69, 0xa6, 0x80, 0xa5,
+    0x42, 0xd, 0x34, 0xc7, 0x2a, 0xa, 0x8c, 0x28, 0x2a, 0x33, 0xaa, 0x82, 0xa3, 0xaa, 0x82, 0xa3,
+    0xba, 0x82, 0xa3, 0xca, 0x82, 0xa3, 0xda, 0x82, 0xa3, 0x75, 0x5, 0x47, 0xd5, 0x5, 0x47, 0x2a,
+    0xa, 0x8d, 0xa8, 0x4a, 0xb, 0xf3, 0x14, 0x15, 0x92, 0x65, 0x35, 0x95, 0x26, 0x99, 0x55, 0x60,
+    0x2, 0xb0, 0x24, 0x80, 0x0, 0x1, 0x7, 0xfe, 0x2, 0x0, 0x7, 0x4, 0x3, 0x4d, 0x34, 0x9,
+    0xaa, 0xa3, 0x41, 0xa7, 0xa9, 0x92, 0x90, 0x72, 0xa9, 0x6, 0xa5, 0x20, 0xea, 0x52, 0xe, 0xe5,
+    0x20, 0xf2, 0x52, 0xf, 0x65, 0x20, 0xdc, 0xa4, 0x1f, 0x4a, 0x41, 0x92, 0x90, 0x61, 0x45, 0x42,
+    0xbf, 0x17, 0x72, 0x45, 0x38, 0x50, 0x90, 0x7f, 0x4e, 0xb7, 0x59};
+
+  std::string expected;
+  for (int i = 0; i < 120000; ++i) {
+    expected += std::to_string(i % 10) + '\n';
+  }
+
+  auto const parallel = cudf::io::cpu_bz2_uncompress_parallel(compressed, sizeof(compressed));
+  ASSERT_TRUE(parallel.has_value());
+  EXPECT_EQ(std::string(parallel->begin(), parallel->end()), expected);
+
+  auto const output = cudf::io::decompress(cudf::io::compression_type::BZIP2,
+                                           {compressed, sizeof(compressed)});
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+}
+
+TEST_F(HostDecompressTest, GzipMultiMember)
+{
+  constexpr uint8_t member[] = {
+    0x1f, 0x8b, 0x8,  0x0,  0x9,  0x63, 0x99, 0x5c, 0x2,  0xff, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+    0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,  0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+
+  // Three concatenated members followed by padding
+  std::vector<uint8_t> compressed;
+  for (int i = 0; i < 3; ++i) {
+    compressed.insert(compressed.end(), std::cbegin(member), std::cend(member));
+  }
+  compressed.resize(compressed.size() + 16, 0);
+
+  auto const output = cudf::io::decompress(cudf::io::compression_type::GZIP, compressed);
+  EXPECT_EQ(std::string(output.begin(), output.end()), "hello worldhello worldhello world");
+}
+
+TEST_F(HostDecompressTest, GzipIndexedRange)
+{
+  // Two members of "<i % 10>\n" and "row,<i % 7>\n" lines, flushed every few hundred bytes
+  constexpr uint8_t compressed[] = {
+    0x1f, 0x8b, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x3, 0x32, 0xe0, 0x32, 0xe4, 0x32, 0xe2, 0x32,
+    0xe6, 0x32, 0xe1, 0x32, 0xe5, 0x32, 0xe3, 0x32, 0xe7, 0xb2, 0xe0, 0xb2, 0xe4, 0x32, 0x18, 0x15,
+    0x1b, 0x30, 0x31, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1a, 0x15, 0x1b, 0x5c, 0x62, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0x1a, 0x15, 0x1b, 0x5c, 0x62, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1a, 0x15, 0x1b,
+    0x5c, 0x62, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1a, 0x15, 0x1b, 0x5c, 0x62, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0x3, 0x0, 0x7e, 0x52, 0xa9, 0xb9, 0xd0, 0x7, 0x0, 0x0, 0x1f, 0x8b, 0x8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0x3, 0x2a, 0xca, 0x2f, 0xd7, 0x31, 0xe0, 0x2a, 0x2, 0x92, 0x86, 0x60, 0xd2,
+    0x8, 0x4c, 0x1a, 0x83, 0x49, 0x13, 0x30, 0x69, 0xa, 0x26, 0xcd, 0xc0, 0xe4, 0xa8, 0xca, 0xe1,
+    0xa0, 0x12, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1a, 0x55, 0x39, 0xf2, 0x54, 0x2, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0x1a, 0x55, 0x39, 0xf2, 0x54, 0x2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1a, 0x55, 0x49, 0xbc,
+    0x4a, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x3, 0x0, 0x23, 0x0, 0xcd, 0x2d, 0x8, 0x7, 0x0, 0x0};
+
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    expected += std::to_string(i % 10) + '\n';
+  }
+  for (int i = 0; i < 300; ++i) {
+    expected += "row," + std::to_string(i % 7) + '\n';
+  }
+
+  std::vector<uint8_t> output;
+  auto const index = cudf::io::build_gzip_index({compressed, sizeof(compressed)}, 100, output);
+  EXPECT_EQ(std::string(output.begin(), output.end()), expected);
+  EXPECT_EQ(index.uncompressed_size, expected.size());
+  EXPECT_GT(index.checkpoints.size(), 2u);
+
+  auto const serialized = cudf::io::serialize_gzip_index(index);
+  auto const restored   = cudf::io::deserialize_gzip_index(serialized);
+  for (auto const& [offset, size] : std::vector<std::pair<size_t, size_t>>{
+         {0, 10}, {5, 1000}, {1999, 2}, {1990, 500}, {2500, 10000}, {expected.size(), 10}}) {
+    auto const [begin, end] = cudf::io::gzip_index_input_range(restored, offset, size);
+    auto const range        = cudf::io::decompress_gzip_range(
+      {compressed + begin, end - begin}, begin, restored, offset, size);
+    EXPECT_EQ(std::string(range.begin(), range.end()), expected.substr(offset, size));
+  }
+
+  // Prefixes inflate across the member boundary and stop at the end of the data
+  for (size_t size : {0, 1, 2000, 2001, 2500, 10000}) {
+    auto const prefix = cudf::io::decompress_gzip_prefix({compressed, sizeof(compressed)}, size);
+    EXPECT_EQ(std::string(prefix.begin(), prefix.end()), expected.substr(0, size));
+  }
+}
+
+TEST_F(HostDecompressTest, ZipMultiEntry)
+{
+  // Directory "dir/", stored "a.csv" and deflated "b.csv"
+  constexpr uint8_t compressed[] = {
+    0x50, 0x4b, 0x3, 0x4, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x54, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x64, 0x69, 0x72, 0x2f, 0x50, 0x4b,
+    0x3, 0x4, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x54, 0x47, 0x93, 0x6c, 0xaf, 0x8, 0x0,
+    0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x61, 0x2e, 0x63, 0x73, 0x76, 0x31, 0x2c,
+    0x32, 0xa, 0x33, 0x2c, 0x34, 0xa, 0x50, 0x4b, 0x3, 0x4, 0x14, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0,
+    0x21, 0x54, 0xf6, 0xc1, 0xe0, 0xaa, 0x8, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x62, 0x2e, 0x63, 0x73, 0x76, 0x33, 0xd5, 0x31, 0xe3, 0x32, 0xc5, 0x83, 0x1, 0x50, 0x4b, 0x1,
+    0x2, 0x14, 0x3, 0x14, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x54, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x80, 0x1, 0x0, 0x0, 0x0, 0x0, 0x64, 0x69, 0x72, 0x2f, 0x50, 0x4b, 0x1, 0x2, 0x14, 0x3, 0x14,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x21, 0x54, 0x47, 0x93, 0x6c, 0xaf, 0x8, 0x0, 0x0, 0x0, 0x8,
+    0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x1, 0x22, 0x0,
+    0x0, 0x0, 0x61, 0x2e, 0x63, 0x73, 0x76, 0x50, 0x4b, 0x1, 0x2, 0x14, 0x3, 0x14, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x21, 0x54, 0xf6, 0xc1, 0xe0, 0xaa, 0x8, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x1, 0x4d, 0x0, 0x0, 0x0,
+    0x62, 0x2e, 0x63, 0x73, 0x76, 0x50, 0x4b, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x3, 0x0,
+    0x98, 0x0, 0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x0, 0x0};
+  cudf::host_span<uint8_t const> const archive{compressed, sizeof(compressed)};
+  std::string const a_csv = "1,2\n3,4\n";
+  std::string b_csv;
+  for (int i = 0; i < 8; ++i) {
+    b_csv += "5,6\n";
+  }
+
+  auto const entries = cudf::io::list_zip_entries(archive);
+  ASSERT_EQ(entries.size(), 3u);
+  EXPECT_EQ(entries[1].name, "a.csv");
+  EXPECT_EQ(entries[1].comp_method, 0);
+  EXPECT_EQ(entries[2].name, "b.csv");
+  EXPECT_EQ(entries[2].comp_method, 8);
+
+  auto const entry_data = cudf::io::decompress_zip_entries(archive, entries);
+  EXPECT_TRUE(entry_data[0].empty());
+  EXPECT_EQ(std::string(entry_data[1].begin(), entry_data[1].end()), a_csv);
+  EXPECT_EQ(std::string(entry_data[2].begin(), entry_data[2].end()), b_csv);
+
+  // All file entries form a single stream
+  auto const output = cudf::io::decompress(cudf::io::compression_type::ZIP, archive);
+  EXPECT_EQ(std::string(output.begin(), output.end()), a_csv + b_csv);
+
+  // Selected entries as separate sources
+  auto archive_source = cudf::io::datasource::create(
+    cudf::io::host_buffer{reinterpret_cast<char const*>(compressed), sizeof(compressed)});
+  auto const sources =
+    cudf::io::datasource::create_from_zip_entries(archive_source.get(), {"b.csv", "a.csv"});
+  ASSERT_EQ(sources.size(), 2u);
+  auto const b_buffer = sources[0]->host_read(0, sources[0]->size());
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(b_buffer->data()), b_buffer->size()), b_csv);
+  auto const a_buffer = sources[1]->host_read(0, sources[1]->size());
+  EXPECT_EQ(std::string(reinterpret_cast<char const*>(a_buffer->data()), a_buffer->size()), a_csv);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,10 +21,12 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/convert/convert_fixed_point.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -1072,6 +1074,139 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+// Builds a gzip member that holds the data in stored (uncompressed) deflate blocks
+std::vector<uint8_t> make_stored_gzip_member(std::string const& data)
+{
+  auto const put_le = [](std::vector<uint8_t>& dst, uint32_t value, int num_bytes) {
+    for (int i = 0; i < num_bytes; ++i) {
+      dst.push_back((value >> (8 * i)) & 0xff);
+    }
+  };
+  uint32_t crc = 0xffffffff;
+  for (unsigned char c : data) {
+    crc ^= c;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xedb88320 & (0u - (crc & 1)));
+    }
+  }
+
+  std::vector<uint8_t> member{0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff};
+  size_t pos = 0;
+  do {
+    auto const block_size = std::min<size_t>(data.size() - pos, 0xffff);
+    member.push_back(pos + block_size == data.size());  // BFINAL; BTYPE 00 is a stored block
+    put_le(member, block_size, 2);
+    put_le(member, ~block_size & 0xffff, 2);
+    member.insert(member.end(), data.begin() + pos, data.begin() + pos + block_size);
+    pos += block_size;
+  } while (pos < data.size());
+  put_le(member, ~crc, 4);
+  put_le(member, data.size(), 4);
+  return member;
+}
+
+TEST_F(CsvReaderTest, ByteRangeGzip)
+{
+  std::string csv;
+  for (int i = 0; i < 2000; ++i) {
+    csv += std::to_string(i) + ',' + std::to_string(i * 3) + '\n';
+  }
+  // Two members, split in the middle of a row
+  auto const split  = csv.size() / 2 + 3;
+  auto compressed   = make_stored_gzip_member(csv.substr(0, split));
+  auto const second = make_stored_gzip_member(csv.substr(split));
+  compressed.insert(compressed.end(), second.begin(), second.end());
+
+  auto filepath = temp_env->get_temp_dir() + "ByteRangeGzip.csv.gz";
+  {
+    std::ofstream outfile(filepath, std::ofstream::binary);
+    outfile.write(reinterpret_cast<char const*>(compressed.data()), compressed.size());
+  }
+
+  auto read_range = [&](size_t offset, size_t size) {
+    cudf_io::csv_reader_options in_opts =
+      cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+        .names({"A", "B"})
+        .dtypes({dtype<int32_t>(), dtype<int32_t>()})
+        .header(-1)
+        .compression(cudf_io::compression_type::GZIP)
+        .byte_range_offset(offset)
+        .byte_range_size(size);
+    return cudf_io::read_csv(in_opts).tbl;
+  };
+
+  auto const full = read_range(0, 0);
+  ASSERT_EQ(full->num_rows(), 2000);
+
+  // Without the cache, each range inflates the file up to the end of the range; with the cache,
+  // the first range builds the seek index and the following ones decompress from a checkpoint
+  auto const cache_capacity = cudf_io::get_metadata_cache_stats().capacity;
+  for (size_t capacity : {0, 1 << 20}) {
+    cudf_io::set_metadata_cache_capacity(capacity);
+    cudf_io::clear_metadata_cache();
+
+    // Ranges of an odd size start and end in the middle of rows, and the last one crosses EOF
+    constexpr size_t range_size = 997;
+    std::vector<std::unique_ptr<table>> ranges;
+    for (size_t offset = 0; offset < csv.size(); offset += range_size) {
+      ranges.push_back(read_range(offset, range_size));
+    }
+    std::vector<table_view> range_views;
+    std::transform(ranges.begin(), ranges.end(), std::back_inserter(range_views), [](auto& tbl) {
+      return tbl->view();
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(full->view(), cudf::concatenate(range_views)->view());
+
+    // A range that starts past the end of the data has no rows
+    EXPECT_EQ(read_range(csv.size() + 10, range_size)->num_rows(), 0);
+
+    EXPECT_EQ(cudf_io::get_metadata_cache_stats().hits, capacity == 0 ? 0 : ranges.size());
+  }
+
+  cudf_io::set_metadata_cache_capacity(cache_capacity);
+}
+
+TEST_F(CsvReaderTest, ChunkedRead)
+{
+  std::string input = "id,name,value\n";
+  std::vector<int64_t> ids;
+  std::vector<double> values;
+  for (int i = 0; i < 100; ++i) {
+    input += std::to_string(i) + ",\"n" + std::to_string(i) + "\"," + std::to_string(i) + ".5\n";
+    ids.push_back(i);
+    values.push_back(i + 0.5);
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{input.c_str(), input.size()})
+      .use_cols_names({"id", "value"});
+
+  // Byte ranges shorter than a row, some of which hold no row
+  auto reader = cudf_io::chunked_csv_reader(7, in_opts);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    EXPECT_EQ(chunk.metadata.column_names, (std::vector<std::string>{"id", "value"}));
+    chunks.push_back(std::move(chunk.tbl));
+  }
+  EXPECT_THROW((void)reader.read_chunk(), cudf::logic_error);
+  EXPECT_GT(chunks.size(), 1u);
+
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  auto const result = cudf::concatenate(views);
+  ASSERT_EQ(type_id::INT64, result->get_column(0).type().id());
+  ASSERT_EQ(type_id::FLOAT64, result->get_column(1).type().id());
+  expect_column_data_equal(ids, result->get_column(0));
+  expect_column_data_equal(values, result->get_column(1));
+
+  // Rows are selected by the byte ranges of the chunks
+  in_opts.set_nrows(10);
+  EXPECT_THROW(cudf_io::chunked_csv_reader(7, in_opts), cudf::logic_error);
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -16,9 +16,26 @@
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/file_utilities.hpp>
+
+#include <cudf/io/data_sink.hpp>
 
 #include <src/io/utilities/file_io_utilities.hpp>
+#include <src/io/utilities/queued_sink.hpp>
+
+#include <fcntl.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <thread>
 #include <type_traits>
 
 // Base test fixture for tests
@@ -43,4 +60,240 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+TEST_F(CuFileIOTest, FileSinkSlicedWrites)
+{
+  cudf::test::temp_directory const temp_dir("file_sink_test");
+  std::vector<char> data(100'000);
+  std::iota(data.begin(), data.end(), 0);
+
+  // Small slices, so that the writes are split; direct IO falls back if not supported
+  setenv("LIBCUDF_FILE_SINK_SLICE_SIZE", "8192", 1);
+  for (auto direct_io : {"0", "1"}) {
+    setenv("LIBCUDF_FILE_SINK_DIRECT_IO", direct_io, 1);
+    auto const filepath = temp_dir.path() + "sliced_" + direct_io + ".bin";
+    {
+      auto sink = cudf::io::data_sink::create(filepath);
+      // Unaligned offsets and sizes
+      size_t offset = 0;
+      for (size_t size : {1000ul, 30'000ul, 0ul, 4096ul, 64'904ul}) {
+        sink->host_write(data.data() + offset, size);
+        offset += size;
+      }
+      ASSERT_EQ(sink->bytes_written(), data.size());
+      sink->flush();
+    }
+    std::ifstream file(filepath, std::ios::binary);
+    std::vector<char> const file_data{std::istreambuf_iterator<char>(file), {}};
+    EXPECT_EQ(file_data, data);
+  }
+  unsetenv("LIBCUDF_FILE_SINK_SLICE_SIZE");
+  unsetenv("LIBCUDF_FILE_SINK_DIRECT_IO");
+}
+
+namespace {
+std::atomic<int> pread_calls{0};
+
+/**
+ * @brief `pread` that reads at most 100 bytes per call and fails every third call with EINTR
+ */
+ssize_t interrupted_pread(int fd, void* buf, size_t count, off_t offset)
+{
+  if (++pread_calls % 3 == 0) {
+    errno = EINTR;
+    return -1;
+  }
+  return pread(fd, buf, std::min<size_t>(count, 100), offset);
+}
+}  // namespace
+
+TEST_F(CuFileIOTest, SlicedHostReads)
+{
+  cudf::test::temp_directory const temp_dir("sliced_host_read_test");
+  auto const filepath = temp_dir.path() + "data.bin";
+  std::vector<uint8_t> data(10'000);
+  std::iota(data.begin(), data.end(), 0);
+  {
+    std::ofstream file(filepath, std::ios::binary);
+    file.write(reinterpret_cast<char const*>(data.data()), data.size());
+  }
+  cudf::io::detail::file_wrapper const file(filepath, O_RDONLY);
+  cudf::detail::thread_pool pool(4);
+
+  // The smallest slice size, so that most reads are split into slices
+  constexpr size_t slice_size = 1024;
+  for (auto read : {cudf::io::detail::pread_function{&pread}, &interrupted_pread}) {
+    // Unaligned offsets and sizes; the last two ranges cross and start past the end of the file
+    for (auto const& [offset, size] : std::vector<std::pair<size_t, size_t>>{
+           {0, 10'000}, {1, 1023}, {1000, 3333}, {4097, 1}, {9000, 5000}, {12'000, 10}}) {
+      auto const begin = data.begin() + std::min(offset, data.size());
+      auto const end   = begin + std::min<size_t>(size, data.end() - begin);
+      std::vector<uint8_t> const expected(begin, end);
+      std::vector<uint8_t> dst(size);
+      auto const bytes_read = cudf::io::detail::sliced_host_read(
+        file, offset, size, dst.data(), slice_size, pool, read);
+      ASSERT_EQ(bytes_read, expected.size());
+      dst.resize(bytes_read);
+      EXPECT_EQ(dst, expected);
+    }
+  }
+
+  // Concurrent reads share the file descriptor and the pool
+  for (int iter = 0; iter < 10; ++iter) {
+    std::vector<uint8_t> dst(data.size());
+    std::vector<std::thread> readers;
+    for (size_t offset = 0; offset < data.size(); offset += 2500) {
+      readers.emplace_back([&, offset] {
+        cudf::io::detail::sliced_host_read(
+          file, offset, 2500, dst.data() + offset, slice_size, pool, &interrupted_pread);
+      });
+    }
+    for (auto& reader : readers) {
+      reader.join();
+    }
+    EXPECT_EQ(dst, data);
+  }
+}
+
+/**
+ * @brief Sink that appends the written data to a vector and records the writing threads
+ */
+class recording_sink : public cudf::io::data_sink {
+ public:
+  recording_sink(std::vector<char>& output, bool background_writes)
+    : _output{output}, _background_writes{background_writes}
+  {
+  }
+
+  void host_write(void const* data, size_t size) override
+  {
+    CUDF_EXPECTS(not fail_writes, "Write failed");
+    // Slow writes, so that the queue fills up
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto const bytes = static_cast<char const*>(data);
+    _output.insert(_output.end(), bytes, bytes + size);
+    writer_threads.insert(std::this_thread::get_id());
+  }
+
+  [[nodiscard]] bool supports_background_writes() const override { return _background_writes; }
+
+  void flush() override { ++flushes; }
+
+  size_t bytes_written() override { return _output.size(); }
+
+  bool fail_writes = false;
+  int flushes      = 0;
+  std::set<std::thread::id> writer_threads;
+
+ private:
+  std::vector<char>& _output;
+  bool const _background_writes;
+};
+
+struct QueuedSinkTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(QueuedSinkTest, WriteOrder)
+{
+  std::vector<char> data(100'000);
+  std::iota(data.begin(), data.end(), 0);
+
+  std::vector<char> output;
+  auto sink           = std::make_unique<recording_sink>(output, true);
+  auto const recorder = sink.get();
+  cudf::io::detail::queued_sink queued(std::move(sink), 4096);
+
+  // Alternate queued buffers and copied pointers, with sizes around the size of the queue
+  size_t offset = 0;
+  for (size_t size = 1; offset + size <= data.size(); size = (size * 7) % 5000 + 1) {
+    if (size % 2 == 0) {
+      auto buffer = queued.get_buffer(size);
+      std::memcpy(buffer.data(), data.data() + offset, size);
+      queued.host_write(std::move(buffer), size);
+    } else {
+      queued.host_write(data.data() + offset, size);
+    }
+    offset += size;
+    EXPECT_EQ(queued.bytes_written(), offset);
+  }
+  queued.flush();
+  EXPECT_EQ(recorder->flushes, 1);
+  EXPECT_EQ(output, std::vector<char>(data.begin(), data.begin() + offset));
+  ASSERT_EQ(recorder->writer_threads.size(), 1u);
+  EXPECT_NE(*recorder->writer_threads.begin(), std::this_thread::get_id());
+}
+
+TEST_F(QueuedSinkTest, DestructorDrainsQueue)
+{
+  std::vector<char> const data(1000, 'x');
+  std::vector<char> output;
+  {
+    cudf::io::detail::queued_sink queued(std::make_unique<recording_sink>(output, true), 1 << 20);
+    for (int i = 0; i < 10; ++i) {
+      queued.host_write(data.data(), data.size());
+    }
+  }
+  EXPECT_EQ(output.size(), 10 * data.size());
+}
+
+TEST_F(QueuedSinkTest, BufferReuse)
+{
+  std::vector<char> output;
+  cudf::io::detail::queued_sink queued(std::make_unique<recording_sink>(output, true), 4096);
+
+  auto buffer         = queued.get_buffer(1000);
+  auto const data_ptr = buffer.data();
+  std::memset(data_ptr, 'a', 1000);
+  queued.host_write(std::move(buffer), 1000);
+  queued.flush();
+
+  // The smallest written buffer that fits is reused
+  auto reused = queued.get_buffer(500);
+  EXPECT_EQ(reused.data(), data_ptr);
+  EXPECT_EQ(reused.capacity(), 1000u);
+  // Buffers that are still in use are not
+  auto other = queued.get_buffer(500);
+  EXPECT_NE(other.data(), data_ptr);
+  EXPECT_EQ(output, std::vector<char>(1000, 'a'));
+}
+
+TEST_F(QueuedSinkTest, WriteError)
+{
+  std::vector<char> const data(1000, 'x');
+  std::vector<char> output;
+  auto sink           = std::make_unique<recording_sink>(output, true);
+  auto const recorder = sink.get();
+  cudf::io::detail::queued_sink queued(std::move(sink), 1 << 20);
+
+  recorder->fail_writes = true;
+  // The error of the queued write is reported by a later call
+  EXPECT_NO_THROW(queued.host_write(data.data(), data.size()));
+  EXPECT_THROW(queued.flush(), cudf::logic_error);
+  EXPECT_EQ(recorder->flushes, 0);
+
+  recorder->fail_writes = false;
+  queued.host_write(data.data(), data.size());
+  queued.flush();
+  EXPECT_EQ(output, data);
+}
+
+TEST_F(QueuedSinkTest, ForegroundSink)
+{
+  std::vector<char> const data(1000, 'x');
+  std::vector<char> output;
+  auto sink           = std::make_unique<recording_sink>(output, false);
+  auto const recorder = sink.get();
+  auto queued         = cudf::io::detail::make_queued_sink(std::move(sink));
+
+  // Sinks that do not support background writes are written on the caller's thread
+  for (int i = 0; i < 3; ++i) {
+    auto buffer = queued->get_buffer(data.size());
+    std::memcpy(buffer.data(), data.data(), data.size());
+    queued->host_write(std::move(buffer), data.size());
+    EXPECT_EQ(output.size(), (i + 1) * data.size());
+  }
+  queued->host_write(data.data(), data.size());
+  EXPECT_EQ(output.size(), 4 * data.size());
+  EXPECT_EQ(recorder->writer_threads, std::set<std::thread::id>{std::this_thread::get_id()});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -26,6 +26,7 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -1362,6 +1363,101 @@ TEST_F(OrcWriterTest, TestMap)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcReaderTest, StripeStatsFilter)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  // Within each stripe, the first row group is all zeros and the others are all 100
+  auto steps = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 5000 < 1000) ? 0. : 100.; });
+  int64_col col0(sequence, sequence + num_rows);
+  float64_col col1(steps, steps + num_rows);
+  table_view expected({col0, col1});
+
+  // 4 stripes of 5000 rows each, with row groups of 1000 rows
+  auto filepath = temp_env->get_temp_filepath("OrcStripeStatsFilter.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stripe_size_rows(5000)
+      .row_index_stride(1000);
+  cudf_io::write_orc(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter,
+                           std::vector<std::vector<cudf::size_type>> stripes = {}) {
+    cudf_io::orc_reader_options in_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+        .stripes(std::move(stripes))
+        .filter(filter);
+    return cudf_io::read_orc(in_opts);
+  };
+
+  auto col_ref = cudf::ast::column_reference(0);
+  auto lo      = cudf::numeric_scalar<int64_t>(12000);
+  auto hi      = cudf::numeric_scalar<int64_t>(13000);
+  auto lit_lo  = cudf::ast::literal(lo);
+  auto lit_hi  = cudf::ast::literal(hi);
+  auto ge      = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, lit_lo);
+  auto lt      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, lit_hi);
+  auto range   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, ge, lt);
+  {
+    // Only the third stripe can hold matching rows
+    auto result = read_filtered(range);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, 15000})[0], result.tbl->view());
+  }
+  {
+    // The filter applies to the selected stripes
+    auto result = read_filtered(range, {{0, 1}});
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    result = read_filtered(range, {{1, 2}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, 15000})[0], result.tbl->view());
+  }
+  {
+    // Stripe statistics include the value, but the statistics of each row group do not
+    auto value  = cudf::numeric_scalar<double>(50.);
+    auto lit    = cudf::ast::literal(value);
+    auto col1   = cudf::ast::column_reference(1);
+    auto eq     = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col1, lit);
+    auto result = read_filtered(eq);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    // Literal type does not match the column type
+    auto value = cudf::numeric_scalar<int32_t>(12000);
+    auto lit   = cudf::ast::literal(value);
+    auto eq    = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    EXPECT_THROW(read_filtered(eq), cudf::logic_error);
+  }
+
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(range);
+  EXPECT_THROW(in_opts.set_skip_rows(10), cudf::logic_error);
+  EXPECT_THROW(in_opts.set_num_rows(10), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, MetadataCache)
+{
+  auto values = random_values<int32_t>(100);
+  int32_col col(values.begin(), values.end());
+  table_view expected({col});
+
+  auto filepath = temp_env->get_temp_filepath("OrcMetadataCache.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::set_metadata_cache_capacity(1 << 20);
+  cudf_io::clear_metadata_cache();
+  cudf_io::orc_reader_options in_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_orc(in_opts).tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf_io::read_orc(in_opts).tbl->view());
+  auto const stats = cudf_io::get_metadata_cache_stats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.hits, 1);
+  cudf_io::set_metadata_cache_capacity(0);
+}
+
 TEST_F(OrcReaderTest, NestedColumnSelection)
 {
   auto const num_rows  = 1000;
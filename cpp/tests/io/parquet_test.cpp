@@ -28,6 +28,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -35,12 +36,17 @@
 #include <cudf/utilities/span.hpp>
 
 #include <src/io/parquet/compact_protocol_reader.hpp>
+#include <src/io/parquet/compact_protocol_writer.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -897,6 +903,39 @@ TEST_F(ParquetWriterTest, HostBuffer)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, SegmentedHostBuffer)
+{
+  constexpr auto num_rows = 100 << 10;
+  const auto seq_col      = random_values<int>(num_rows);
+  column_wrapper<int> col{seq_col.begin(), seq_col.end()};
+  table_view expected({col});
+
+  // Small segments, so that the output spans many of them
+  cudf_io::segmented_host_buffer_sink sink(10'000);
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&sink), expected);
+  cudf_io::write_parquet(out_opts);
+
+  auto const segments = sink.segments();
+  EXPECT_GT(segments.size(), 1u);
+  std::vector<char> segment_data;
+  for (auto const& segment : segments) {
+    segment_data.insert(segment_data.end(), segment.begin(), segment.end());
+  }
+  EXPECT_EQ(segment_data.size(), sink.bytes_written());
+
+  auto const buffer = sink.consolidate();
+  EXPECT_EQ(sink.segments().size(), 1u);
+  ASSERT_EQ(buffer.size(), segment_data.size());
+  EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), segment_data.begin()));
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(reinterpret_cast<char const*>(buffer.data()), buffer.size()));
+  const auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -2536,6 +2575,496 @@ TEST_F(ParquetReaderTest, ListUserBoundsWithNullsLarge)
   }
 }
 
+TEST_F(ParquetReaderTest, PageFilterWithoutPageIndex)
+{
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int64_t> col(sequence, sequence + 1000);
+  auto expected = table_view{{col}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("a");
+
+  auto filepath = temp_env->get_temp_filepath("PageFilterWithoutPageIndex.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata);
+  cudf_io::write_parquet(out_opts);
+
+  // The file has no page index, so no data can be skipped and all rows are returned
+  cudf_io::parquet_page_filter filter{"a", int64_t{2000}, std::nullopt};
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).page_filter(filter);
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // Filter on a column that does not exist
+  in_opts.set_page_filter({"b", std::nullopt, int64_t{10}});
+  EXPECT_THROW(cudf_io::read_parquet(in_opts), cudf::logic_error);
+
+  // A page filter can't be combined with a row range
+  EXPECT_THROW(in_opts.set_skip_rows(10), cudf::logic_error);
+  EXPECT_THROW(in_opts.set_num_rows(10), cudf::logic_error);
+}
+
+/**
+ * @brief Adds an offset index and a column index to a file of `INT64` columns without nulls
+ *
+ * The writer does not write a page index, so the page locations are found from the page headers,
+ * and the page bounds are computed from `values`, the values of every column.
+ */
+void add_int64_page_index(std::string const& filepath, std::vector<int64_t> const& values)
+{
+  std::ifstream infile(filepath, std::ifstream::binary);
+  std::vector<uint8_t> file((std::istreambuf_iterator<char>(infile)),
+                            std::istreambuf_iterator<char>());
+  infile.close();
+
+  // The footer is followed by its length and by the magic bytes
+  uint32_t footer_len = 0;
+  std::memcpy(&footer_len, file.data() + file.size() - 8, sizeof(footer_len));
+  auto const footer_offset = file.size() - 8 - footer_len;
+  cudf_io::parquet::FileMetaData fmd;
+  cudf_io::parquet::CompactProtocolReader cp(file.data() + footer_offset, footer_len);
+  ASSERT_TRUE(cp.read(&fmd));
+
+  auto const encode = [](int64_t value) {
+    std::vector<uint8_t> encoded(sizeof(value));
+    std::memcpy(encoded.data(), &value, sizeof(value));
+    return encoded;
+  };
+
+  // The page index of all chunks is written ahead of the footer
+  std::vector<uint8_t> output(file.begin(), file.begin() + footer_offset);
+  cudf_io::parquet::CompactProtocolWriter cpw(&output);
+  int64_t row_group_start = 0;
+  for (auto& row_group : fmd.row_groups) {
+    for (auto& chunk : row_group.columns) {
+      auto const& meta = chunk.meta_data;
+      auto page_offset = (meta.dictionary_page_offset != 0)
+                           ? std::min(meta.data_page_offset, meta.dictionary_page_offset)
+                           : meta.data_page_offset;
+      auto const chunk_end = page_offset + meta.total_compressed_size;
+
+      cudf_io::parquet::OffsetIndex offset_index;
+      cudf_io::parquet::ColumnIndex column_index;
+      column_index.boundary_order = cudf_io::parquet::ASCENDING;
+      int64_t first_row           = 0;
+      while (page_offset < chunk_end) {
+        cudf_io::parquet::PageHeader header;
+        cudf_io::parquet::CompactProtocolReader hp(file.data() + page_offset,
+                                                   chunk_end - page_offset);
+        ASSERT_TRUE(hp.read(&header));
+        auto const page_size = hp.bytecount() + header.compressed_page_size;
+        if (header.type == cudf_io::parquet::PageType::DATA_PAGE) {
+          auto const page_rows = header.data_page_header.num_values;
+          offset_index.page_locations.push_back(
+            {page_offset, static_cast<int32_t>(page_size), first_row});
+          auto const page_values = values.begin() + row_group_start + first_row;
+          auto const [min, max]  = std::minmax_element(page_values, page_values + page_rows);
+          column_index.null_pages.push_back(false);
+          column_index.min_values.push_back(encode(*min));
+          column_index.max_values.push_back(encode(*max));
+          first_row += page_rows;
+        }
+        page_offset += page_size;
+      }
+
+      chunk.offset_index_offset = output.size();
+      chunk.offset_index_length = static_cast<int32_t>(cpw.write(offset_index));
+      chunk.column_index_offset = output.size();
+      chunk.column_index_length = static_cast<int32_t>(cpw.write(column_index));
+    }
+    row_group_start += row_group.num_rows;
+  }
+
+  footer_len = cpw.write(fmd);
+  auto const footer_len_bytes = reinterpret_cast<uint8_t const*>(&footer_len);
+  output.insert(output.end(), footer_len_bytes, footer_len_bytes + sizeof(footer_len));
+  output.insert(output.end(), file.end() - 4, file.end());
+
+  std::ofstream outfile(filepath, std::ofstream::binary | std::ofstream::trunc);
+  outfile.write(reinterpret_cast<char const*>(output.data()), output.size());
+}
+
+/**
+ * @brief Source that reads a file and counts the bytes read from it
+ */
+class byte_counting_source : public cudf_io::datasource {
+ public:
+  explicit byte_counting_source(std::string const& filepath)
+    : _source(cudf_io::datasource::create(filepath))
+  {
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto data = _source->host_read(offset, size);
+    _bytes_read += data->size();
+    return data;
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    auto const read_size = _source->host_read(offset, size, dst);
+    _bytes_read += read_size;
+    return read_size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+  [[nodiscard]] size_t bytes_read() const { return _bytes_read; }
+
+ private:
+  std::unique_ptr<cudf_io::datasource> _source;
+  std::atomic<size_t> _bytes_read{0};
+};
+
+TEST_F(ParquetReaderTest, PageIndex)
+{
+  constexpr cudf::size_type num_rows  = 10000;
+  constexpr cudf::size_type page_rows = 1000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  std::vector<int64_t> values(sequence, sequence + num_rows);
+  column_wrapper<int64_t> col(values.begin(), values.end());
+  auto expected = table_view{{col}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("a");
+
+  auto filepath = temp_env->get_temp_filepath("PageIndex.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::NONE)
+      .max_page_size_rows(page_rows);
+  cudf_io::write_parquet(out_opts);
+  add_int64_page_index(filepath, values);
+
+  byte_counting_source full_source(filepath);
+  cudf_io::parquet_reader_options full_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{&full_source});
+  auto result = cudf_io::read_parquet(full_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // Rows within a single page are read from that page only
+  byte_counting_source partial_source(filepath);
+  cudf_io::parquet_reader_options partial_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{&partial_source})
+      .skip_rows(4200)
+      .num_rows(300);
+  result = cudf_io::read_parquet(partial_opts);
+  auto expected_partial = cudf::slice(expected, {4200, 4500});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_partial[0], result.tbl->view());
+  EXPECT_LT(partial_source.bytes_read(), full_source.bytes_read() / 4);
+
+  // The page filter reads all rows of the pages whose bounds overlap the range
+  byte_counting_source filter_source(filepath);
+  cudf_io::parquet_reader_options filter_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{&filter_source})
+      .page_filter({"a", int64_t{4500}, int64_t{5200}});
+  result = cudf_io::read_parquet(filter_opts);
+  auto expected_filtered = cudf::slice(expected, {4000, 6000});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_filtered[0], result.tbl->view());
+  EXPECT_LT(filter_source.bytes_read(), full_source.bytes_read() / 2);
+}
+
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  constexpr cudf::size_type num_rows = 40000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  // A single row group of 8 pages
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .max_page_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_chunks = [&](std::size_t chunk_read_limit, cudf_io::parquet_reader_options options) {
+    auto reader = cudf_io::chunked_parquet_reader(chunk_read_limit, 0, options);
+    std::vector<std::unique_ptr<table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(reader.read_chunk().tbl);
+    }
+    EXPECT_THROW((void)reader.read_chunk(), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate_chunks = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<table_view> views;
+    std::transform(chunks.cbegin(), chunks.cend(), std::back_inserter(views), [](auto& chunk) {
+      return chunk->view();
+    });
+    return cudf::concatenate(views);
+  };
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  {
+    auto const chunks = read_chunks(0, in_opts);
+    ASSERT_EQ(chunks.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunks[0]->view());
+  }
+  {
+    // The row group is split at page boundaries
+    auto const chunks = read_chunks(64 * 1024, in_opts);
+    EXPECT_GT(chunks.size(), 1u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, concatenate_chunks(chunks)->view());
+  }
+  {
+    // Limits smaller than a page yield one chunk per page
+    in_opts.set_skip_rows(3000);
+    in_opts.set_num_rows(20000);
+    auto const chunks = read_chunks(1, in_opts);
+    EXPECT_EQ(chunks.size(), 5u);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {3000, 23000})[0],
+                                  concatenate_chunks(chunks)->view());
+  }
+  {
+    // An empty selection is read as a single empty table
+    in_opts.set_num_rows(0);
+    auto const chunks = read_chunks(1, in_opts);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0]->num_rows(), 0);
+    EXPECT_EQ(chunks[0]->num_columns(), 2);
+  }
+}
+
+TEST_F(ParquetReaderTest, RowGroupStatsFilter)
+{
+  constexpr cudf::size_type num_rows = 20000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  // 4 row groups of 5000 rows each
+  auto filepath = temp_env->get_temp_filepath("RowGroupStatsFilter.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(in_opts);
+  };
+
+  auto col_ref = cudf::ast::column_reference(0);
+  auto lo      = cudf::numeric_scalar<int64_t>(12000);
+  auto hi      = cudf::numeric_scalar<int64_t>(13000);
+  auto lit_lo  = cudf::ast::literal(lo);
+  auto lit_hi  = cudf::ast::literal(hi);
+  auto ge      = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, lit_lo);
+  auto lt      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, lit_hi);
+  auto range   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, ge, lt);
+  {
+    // Only the third row group can hold matching rows
+    auto result = read_filtered(range);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, 15000})[0], result.tbl->view());
+  }
+  {
+    // Only rows of the last two row groups can satisfy the range or the negation of its bound
+    auto not_lt = cudf::ast::operation(cudf::ast::ast_operator::NOT, lt);
+    auto either = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, range, not_lt);
+    auto result = read_filtered(either);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {10000, 20000})[0], result.tbl->view());
+  }
+  {
+    // No row group can hold matching rows
+    auto none   = cudf::numeric_scalar<double>(-1.);
+    auto lit    = cudf::ast::literal(none);
+    auto col1   = cudf::ast::column_reference(1);
+    auto eq     = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col1, lit);
+    auto result = read_filtered(eq);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+  }
+  {
+    // Literal type does not match the column type
+    auto value = cudf::numeric_scalar<int32_t>(12000);
+    auto lit   = cudf::ast::literal(value);
+    auto eq    = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    EXPECT_THROW(read_filtered(eq), cudf::logic_error);
+  }
+}
+
+TEST_F(ParquetReaderTest, MetadataCache)
+{
+  column_wrapper<int32_t> col{1, 2, 3};
+  auto expected = table_view{{col}};
+
+  auto filepath = temp_env->get_temp_filepath("MetadataCache.parquet");
+  auto write    = [&](table_view const& table) {
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, table);
+    cudf_io::write_parquet(out_opts);
+  };
+  auto read = [&]() {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+    return cudf_io::read_parquet(in_opts);
+  };
+  write(expected);
+
+  cudf_io::set_metadata_cache_capacity(1 << 20);
+  cudf_io::clear_metadata_cache();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, read().tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, read().tbl->view());
+  auto stats = cudf_io::get_metadata_cache_stats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.hits, 1);
+
+  // Entries are charged the size of the decoded metadata, larger than the encoded footer
+  std::ifstream infile(filepath, std::ifstream::binary);
+  infile.seekg(-8, std::ifstream::end);
+  uint32_t footer_len = 0;
+  infile.read(reinterpret_cast<char*>(&footer_len), sizeof(footer_len));
+  EXPECT_GT(stats.size, footer_len);
+
+  // Rewriting the file changes its size, so the cached metadata is not used
+  column_wrapper<int32_t> new_col{1, 2, 3, 4};
+  auto new_expected = table_view{{new_col}};
+  write(new_expected);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(new_expected, read().tbl->view());
+  stats = cudf_io::get_metadata_cache_stats();
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.hits, 1);
+
+  // Disabling the cache drops all entries
+  cudf_io::set_metadata_cache_capacity(0);
+  stats = cudf_io::get_metadata_cache_stats();
+  EXPECT_EQ(stats.size, 0);
+  EXPECT_EQ(stats.evictions, 2);
+}
+
+TEST_F(ParquetReaderTest, ColumnProjection)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+
+  constexpr auto num_rows = 12000;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> a(values, values + num_rows);
+  column_wrapper<double> b(values, values + num_rows);
+  auto strings =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i % 3); });
+  cudf::test::strings_column_wrapper c(strings, strings + num_rows);
+  lcw d_row{{1, 2}, {3}};
+  std::vector<cudf::column_view> d_rows(num_rows / 2, cudf::column_view{d_row});
+  auto d_col = cudf::concatenate(d_rows);
+
+  table_view tbl{{a, b, c, *d_col}};
+  cudf_io::table_input_metadata md(tbl);
+  md.column_metadata[0].set_name("a");
+  md.column_metadata[1].set_name("b");
+  md.column_metadata[2].set_name("c");
+  md.column_metadata[3].set_name("d");
+
+  auto filepath = temp_env->get_temp_filepath("ColumnProjection.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, tbl)
+      .metadata(&md)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  // Only the column chunks of the selected columns are decoded from the file metadata
+  auto read = [&](std::vector<std::string> const& columns) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).columns(columns);
+    return cudf_io::read_parquet(in_opts);
+  };
+
+  auto result = read({"c", "a"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({c, a}), result.tbl->view());
+  EXPECT_EQ(result.metadata.column_names[0], "c");
+  EXPECT_EQ(result.metadata.column_names[1], "a");
+
+  result = read({"d"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({*d_col}), result.tbl->view());
+
+  // Row group selection is applied to the projected columns
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .columns({"b"})
+      .row_groups({{2}});
+  result        = cudf_io::read_parquet(in_opts);
+  auto expected = cudf::slice(b, {10000, num_rows});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expected[0]}), result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, ColumnProjectionUndecodedChunks)
+{
+  constexpr auto num_rows = 12000;
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> a(values, values + num_rows);
+  column_wrapper<int32_t> bb(values, values + num_rows);
+
+  table_view tbl{{a, bb}};
+  cudf_io::table_input_metadata md(tbl);
+  md.column_metadata[0].set_name("a");
+  md.column_metadata[1].set_name("bb");
+
+  auto filepath = temp_env->get_temp_filepath("ColumnProjectionUndecodedChunks.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, tbl)
+      .metadata(&md)
+      .row_group_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  // Rename the path of the column chunks of "bb", so that they fail to map to the schema once
+  // decoded; the schema itself is left untouched
+  {
+    std::ifstream infile(filepath, std::ifstream::binary);
+    std::vector<char> file((std::istreambuf_iterator<char>(infile)),
+                           std::istreambuf_iterator<char>());
+    infile.close();
+    uint32_t footer_len = 0;
+    std::memcpy(&footer_len, file.data() + file.size() - 8, sizeof(footer_len));
+    auto const footer_offset = file.size() - 8 - footer_len;
+
+    cudf_io::parquet::FileMetaData fmd;
+    cudf_io::parquet::CompactProtocolReader cp(
+      reinterpret_cast<uint8_t const*>(file.data()) + footer_offset, footer_len);
+    ASSERT_TRUE(cp.read_deferred(&fmd));
+    ASSERT_EQ(fmd.row_groups.size(), 3);
+    std::string const name = "bb";
+    for (auto const& row_group : fmd.row_groups) {
+      ASSERT_EQ(row_group.column_locations.size(), 2);
+      auto const begin = file.begin() + footer_offset + row_group.column_locations[1].offset;
+      auto const end   = begin + row_group.column_locations[1].length;
+      auto const path  = std::search(begin, end, name.begin(), name.end());
+      ASSERT_NE(path, end);
+      std::fill_n(path, name.size(), 'z');
+    }
+
+    std::ofstream outfile(filepath, std::ofstream::binary | std::ofstream::trunc);
+    outfile.write(file.data(), file.size());
+  }
+
+  // Metadata is only decoded in part when it is not cached
+  auto const cache_capacity = cudf_io::get_metadata_cache_stats().capacity;
+  cudf_io::set_metadata_cache_capacity(0);
+
+  // The column chunks of "bb" are left encoded when only "a" is read
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).columns({"a"});
+  auto result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({a}), result.tbl->view());
+
+  in_opts.set_columns({"bb"});
+  EXPECT_THROW(cudf_io::read_parquet(in_opts), cudf::logic_error);
+  cudf_io::parquet_reader_options all_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  EXPECT_THROW(cudf_io::read_parquet(all_opts), cudf::logic_error);
+
+  cudf_io::set_metadata_cache_capacity(cache_capacity);
+}
+
 TEST_F(ParquetReaderTest, ReorderedColumns)
 {
   {
@@ -16,8 +16,11 @@
 
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <src/strings/regex/regcomp.h>
+
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -27,6 +30,7 @@
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <string_view>
 #include <vector>
 
 struct StringsContainsTests : public cudf::test::BaseFixture {
@@ -451,6 +455,84 @@ TEST_F(StringsContainsTests, MultiLine)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
 }
 
+TEST_F(StringsContainsTests, RegexProgram)
+{
+  auto input =
+    cudf::test::strings_column_wrapper({"abc\nfff\nabc", "fff\nabc\nlll", "abc", "", "abc\n"});
+  auto view = cudf::strings_column_view(input);
+
+  auto const prog =
+    cudf::strings::regex_program::create("^(abc)$", cudf::strings::regex_flags::MULTILINE);
+  EXPECT_EQ(prog->pattern(), "^(abc)$");
+  EXPECT_EQ(prog->flags(), cudf::strings::regex_flags::MULTILINE);
+  EXPECT_EQ(prog->groups_count(), 1);
+  EXPECT_GT(prog->instructions_count(), 0);
+
+  // a program is reused by several calls and matches as its pattern and flags do
+  for (int i = 0; i < 2; ++i) {
+    auto results           = cudf::strings::contains_re(view, *prog);
+    auto expected_contains = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_contains);
+    results               = cudf::strings::matches_re(view, *prog);
+    auto expected_matches = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_matches);
+    results             = cudf::strings::count_re(view, *prog);
+    auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({2, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+  }
+
+  // the cached program of a pattern is not shared with other flags
+  auto results        = cudf::strings::count_re(view, "^(abc)$");
+  auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+
+  EXPECT_THROW(cudf::strings::regex_program::create("(3?)+"), cudf::logic_error);
+}
+
+TEST_F(StringsContainsTests, RequiredLiteral)
+{
+  // rows containing a literal required by the patterns, without matching the whole pattern
+  auto input = cudf::test::strings_column_wrapper({"id 12 ERROR 404 x",
+                                                   "ERROR x",
+                                                   "warn 7 de",
+                                                   "",
+                                                   "ERROR 1 ERROR 22",
+                                                   "aade abde acde",
+                                                   "abd de abcabcx"});
+  auto view = cudf::strings_column_view(input);
+
+  auto results        = cudf::strings::count_re(view, "ERROR \\d+");
+  auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 0, 0, 2, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+  results                = cudf::strings::contains_re(view, ".*ERROR \\d+");
+  auto expected_contains = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_contains);
+
+  results        = cudf::strings::count_re(view, "a(b|c)de");
+  expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0, 0, 0, 2, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+  results        = cudf::strings::count_re(view, "(abc)+x");
+  expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0, 0, 0, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+  results        = cudf::strings::count_re(view, "^\\w+ \\d+");
+  expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 1, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
+
+  // the literals found for the patterns; none if a match can avoid every literal
+  auto const prefilter = [](std::string_view pattern) {
+    auto const prog =
+      cudf::strings::detail::reprog::create_from(pattern, cudf::strings::regex_flags::DEFAULT);
+    return prog.prefilter();
+  };
+  EXPECT_EQ(prefilter(".*ERROR \\d+"), "ERROR ");
+  EXPECT_EQ(prefilter("a(b|c)de"), "de");
+  EXPECT_EQ(prefilter("(abc)+x"), "abc");
+  EXPECT_EQ(prefilter("(x|a)bcd"), "bcd");
+  EXPECT_EQ(prefilter("a|b"), "");
+  EXPECT_EQ(prefilter("a?b?"), "");
+  EXPECT_EQ(prefilter("x*"), "");
+}
+
 TEST_F(StringsContainsTests, DotAll)
 {
   auto input = cudf::test::strings_column_wrapper({"abc\nfa\nef", "fff\nabbc\nfff", "abcdef", ""});
@@ -23,6 +23,7 @@
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/strings/extract.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -185,6 +186,30 @@ TEST_F(StringsExtractTests, DotAll)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
 }
 
+TEST_F(StringsExtractTests, WithProgram)
+{
+  auto input =
+    cudf::test::strings_column_wrapper({"abc\nfff\nabc", "fff\nabc\nlll", "abc", "", "abc\n"});
+  auto view = cudf::strings_column_view(input);
+
+  auto const prog =
+    cudf::strings::regex_program::create("(^[a-c]+$)", cudf::strings::regex_flags::MULTILINE);
+  auto results = cudf::strings::extract(view, *prog);
+  cudf::test::strings_column_wrapper expected_multiline({"abc", "abc", "abc", "", "abc"},
+                                                        {1, 1, 1, 0, 1});
+  auto expected = cudf::table_view{{expected_multiline}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
+
+  cudf::test::strings_column_wrapper all_input({"123 banana 7 eleven", "41 apple", "", "bees"});
+  auto all_view       = cudf::strings_column_view(all_input);
+  auto const all_prog = cudf::strings::regex_program::create("(\\d+) (\\w+)");
+  auto all_results    = cudf::strings::extract_all_record(all_view, *all_prog);
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected_all({LCW{"123", "banana", "7", "eleven"}, LCW{"41", "apple"}, LCW{}, LCW{}},
+                   {1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(all_results->view(), expected_all);
+}
+
 TEST_F(StringsExtractTests, EmptyExtractTest)
 {
   std::vector<const char*> h_strings{nullptr, "AAA", "AAA_A", "AAA_AAA_", "A__", ""};
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/strings/replace_re.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -214,6 +215,29 @@ TEST_F(StringsReplaceRegexTest, Multiline)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, br_expected);
 }
 
+TEST_F(StringsReplaceRegexTest, WithProgram)
+{
+  auto const multiline = cudf::strings::regex_flags::MULTILINE;
+
+  cudf::test::strings_column_wrapper input({"bcd\naba\nefg", "aba\naba abab\naba", "aba"});
+  auto sv = cudf::strings_column_view(input);
+
+  auto const prog = cudf::strings::regex_program::create("^aba$", multiline);
+  auto results    = cudf::strings::replace_re(sv, *prog, cudf::string_scalar("_"));
+  cudf::test::strings_column_wrapper expected({"bcd\n_\nefg", "_\naba abab\n_", "_"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  results = cudf::strings::replace_re(sv, *prog, cudf::string_scalar("_"), 1);
+  cudf::test::strings_column_wrapper expected_once({"bcd\n_\nefg", "_\naba abab\naba", "_"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_once);
+
+  auto const br_prog = cudf::strings::regex_program::create("(^aba)", multiline);
+  results            = cudf::strings::replace_with_backrefs(sv, *br_prog, "[\\1]");
+  cudf::test::strings_column_wrapper br_expected(
+    {"bcd\n[aba]\nefg", "[aba]\n[aba] abab\n[aba]", "[aba]"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, br_expected);
+}
+
 TEST_F(StringsReplaceRegexTest, ReplaceBackrefsRegexTest)
 {
   std::vector<const char*> h_strings{"the quick brown fox jumps over the lazy dog",
@@ -25,12 +25,24 @@ import java.io.DataOutputStream;
 import java.io.EOFException;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.InterruptedIOException;
 import java.io.OutputStream;
 import java.nio.ByteBuffer;
+import java.nio.channels.GatheringByteChannel;
+import java.nio.channels.WritableByteChannel;
 import java.util.ArrayDeque;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.Optional;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.zip.CRC32;
+import java.util.zip.DataFormatException;
+import java.util.zip.Deflater;
+import java.util.zip.Inflater;
 
 /**
  * Serialize and deserialize CUDF tables and columns using a custom format.  The goal of this is
@@ -57,6 +69,16 @@ import java.util.Optional;
  * a null being in the data.  This is not likely to cause issues if the data is processed using cudf
  * as the null count is only used as a flag to check if a validity buffer is needed or not.
  * Processing outside of cudf should be careful.
+ * <p>
+ * Tables can optionally be written with their data compressed, which uses a newer version of the
+ * format. The data is then split into blocks of up to 1 MiB that each carry a CRC32 checksum of
+ * their uncompressed bytes. Blocks end at column buffer boundaries once they hold 64 KiB, so
+ * buffers that do not compress well, which are stored as is, do not affect the others. Tables
+ * written without compression use the original format, and both are read transparently.
+ * <p>
+ * Concatenating many tables on the host splits the work across a pool of threads, whose size is
+ * set by the ai.rapids.cudf.serialization.concatThreads system property and defaults to the
+ * number of processors. Setting it to 1 concatenates on the calling thread.
  */
 public class JCudfSerialization {
   /**
@@ -66,6 +88,19 @@ public class JCudfSerialization {
    */
   private static final int SER_FORMAT_MAGIC_NUMBER = 0x43554446;
   private static final short VERSION_NUMBER = 0x0000;
+  /** Version of the format with compressed and checksummed data blocks */
+  private static final short COMPRESSED_VERSION_NUMBER = 0x0001;
+  private static final int COMPRESSED_BLOCK_SIZE = 1024 * 1024;
+  // A column buffer ends the current compressed block once it holds at least this many bytes
+  private static final int MIN_COMPRESSED_BLOCK_SIZE = 64 * 1024;
+  // Codec of a compressed block that is stored uncompressed
+  private static final byte STORED_BLOCK = (byte) CompressionType.NONE.nativeId;
+  // Host concatenation of less data than this stays on the calling thread
+  private static final long MIN_PARALLEL_CONCAT_BYTES = 4 * 1024 * 1024;
+  // Approximate amount of data copied by each concatenation task
+  private static final long CONCAT_TASK_BYTES = 1024 * 1024;
+  // Number of tables indexed by each concatenation task
+  private static final int CONCAT_TABLES_PER_TASK = 32;
 
   private static final class ColumnOffsets {
     private final long validity;
@@ -91,6 +126,7 @@ public class JCudfSerialization {
     private SerializedColumnHeader[] columns;
     private int numRows;
     private long dataLen;
+    private CompressionType compression = CompressionType.NONE;
 
     private boolean initialized = false;
     private boolean dataRead = false;
@@ -132,6 +168,14 @@ public class JCudfSerialization {
       return dataLen;
     }
 
+    /**
+     * Returns the compression of the serialized data. Data read by readTableIntoBuffer is
+     * always uncompressed.
+     */
+    public CompressionType getCompression() {
+      return compression;
+    }
+
     /**
      * Returns the number of rows stored in this table.
      */
@@ -167,13 +211,19 @@ public class JCudfSerialization {
       // - 4-byte row count
       // - 8-byte data buffer length
       long total = 4 + 2 + 4 + 4 + 8;
+      if (compression != CompressionType.NONE) {
+        total += 1;  // 1-byte compression codec
+      }
       for (SerializedColumnHeader column : columns) {
         total += column.getSerializedHeaderSizeInBytes();
       }
       return total;
     }
 
-    /** Returns the number of bytes needed to serialize this table header and the table data. */
+    /**
+     * Returns the number of bytes needed to serialize this table header and the table data.
+     * For compressed data this is the size before compression.
+     */
     public long getTotalSerializedSizeInBytes() {
       return getSerializedHeaderSizeInBytes() + dataLen;
     }
@@ -191,9 +241,11 @@ public class JCudfSerialization {
         return;
       }
       short version = din.readShort();
-      if (version != VERSION_NUMBER) {
+      if (version == COMPRESSED_VERSION_NUMBER) {
+        compression = compressionFromId(din.readByte());
+      } else if (version != VERSION_NUMBER) {
         throw new IllegalStateException("READING THE WRONG SERIALIZATION FORMAT VERSION FOUND "
-            + version + " EXPECTED " + VERSION_NUMBER);
+            + version + " EXPECTED " + VERSION_NUMBER + " OR " + COMPRESSED_VERSION_NUMBER);
       }
       int numColumns = din.readInt();
       numRows = din.readInt();
@@ -210,7 +262,12 @@ public class JCudfSerialization {
     public void writeTo(DataWriter dout) throws IOException {
       // Now write out the data
       dout.writeInt(SER_FORMAT_MAGIC_NUMBER);
-      dout.writeShort(VERSION_NUMBER);
+      if (compression != CompressionType.NONE) {
+        dout.writeShort(COMPRESSED_VERSION_NUMBER);
+        dout.writeByte((byte) compression.nativeId);
+      } else {
+        dout.writeShort(VERSION_NUMBER);
+      }
       dout.writeInt(columns.length);
       dout.writeInt(numRows);
 
@@ -596,6 +653,13 @@ public class JCudfSerialization {
       // NOOP by default
     }
 
+    /**
+     * Called after each column buffer and its padding are written.
+     */
+    public void endBuffer() throws IOException {
+      // NOOP by default
+    }
+
     public abstract void write(byte[] arr, int offset, int length) throws IOException;
   }
 
@@ -662,10 +726,15 @@ public class JCudfSerialization {
 
   private static final class HostDataWriter extends DataWriter {
     private final HostMemoryBuffer buffer;
-    private long offset = 0;
+    private long offset;
 
     public HostDataWriter(HostMemoryBuffer buffer) {
+      this(buffer, 0);
+    }
+
+    public HostDataWriter(HostMemoryBuffer buffer, long offset) {
       this.buffer = buffer;
+      this.offset = offset;
     }
 
     @Override
@@ -711,6 +780,243 @@ public class JCudfSerialization {
     }
   }
 
+  /**
+   * Writes to a blocking channel. Large column buffers are handed to the channel directly instead
+   * of being copied through a Java array, together with any pending header bytes when the
+   * channel supports gathering writes.
+   */
+  private static final class ChannelDataWriter extends DataWriter {
+    // Buffers smaller than this are copied to the staging buffer to batch small writes
+    private static final int MIN_DIRECT_WRITE_SIZE = 32 * 1024;
+    private final WritableByteChannel channel;
+    private final ByteBuffer staging = ByteBuffer.allocate(128 * 1024);
+
+    public ChannelDataWriter(WritableByteChannel channel) {
+      this.channel = channel;
+    }
+
+    @Override
+    public void writeByte(byte b) throws IOException {
+      ensureStagingSpace(1);
+      staging.put(b);
+    }
+
+    @Override
+    public void writeShort(short s) throws IOException {
+      ensureStagingSpace(2);
+      staging.putShort(s);
+    }
+
+    @Override
+    public void writeInt(int i) throws IOException {
+      ensureStagingSpace(4);
+      staging.putInt(i);
+    }
+
+    @Override
+    public void writeIntNativeOrder(int i) throws IOException {
+      // Same as DataOutputStreamWriter, this only works on Little Endian Architectures.
+      writeInt(Integer.reverseBytes(i));
+    }
+
+    @Override
+    public void writeLong(long val) throws IOException {
+      ensureStagingSpace(8);
+      staging.putLong(val);
+    }
+
+    @Override
+    public void copyDataFrom(HostMemoryBuffer src, long srcOffset, long len) throws IOException {
+      if (len < MIN_DIRECT_WRITE_SIZE) {
+        ensureStagingSpace((int) len);
+        src.getBytes(staging.array(), staging.arrayOffset() + staging.position(), srcOffset, len);
+        staging.position(staging.position() + (int) len);
+        return;
+      }
+      while (len > 0) {
+        int amountToWrite = (int) Math.min(Integer.MAX_VALUE, len);
+        staging.flip();
+        writeFully(staging, src.asByteBuffer(srcOffset, amountToWrite));
+        staging.clear();
+        srcOffset += amountToWrite;
+        len -= amountToWrite;
+      }
+    }
+
+    @Override
+    public void flush() throws IOException {
+      staging.flip();
+      writeFully(staging);
+      staging.clear();
+    }
+
+    @Override
+    public void write(byte[] arr, int offset, int length) throws IOException {
+      if (length > staging.capacity()) {
+        staging.flip();
+        writeFully(staging, ByteBuffer.wrap(arr, offset, length));
+        staging.clear();
+      } else {
+        ensureStagingSpace(length);
+        staging.put(arr, offset, length);
+      }
+    }
+
+    private void ensureStagingSpace(int bytes) throws IOException {
+      if (staging.remaining() < bytes) {
+        flush();
+      }
+    }
+
+    private void writeFully(ByteBuffer... buffers) throws IOException {
+      ByteBuffer last = buffers[buffers.length - 1];
+      if (channel instanceof GatheringByteChannel) {
+        GatheringByteChannel gathering = (GatheringByteChannel) channel;
+        // The buffers are written in order, so they are all written once the last one is
+        while (last.hasRemaining() || buffers[0].hasRemaining()) {
+          gathering.write(buffers);
+        }
+      } else {
+        for (ByteBuffer buffer : buffers) {
+          while (buffer.hasRemaining()) {
+            channel.write(buffer);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Writes the data of a table to another writer as compressed blocks, each preceded by its
+   * codec, its uncompressed and compressed sizes and the CRC32 of its uncompressed bytes.
+   * Blocks that do not get smaller are stored uncompressed.
+   */
+  private static final class CompressedDataWriter extends DataWriter {
+    private final DataWriter out;
+    private final byte codec;
+    private final byte[] block;
+    private final byte[] compressed;
+    private final Deflater deflater = new Deflater(Deflater.BEST_SPEED);
+    private final CRC32 crc = new CRC32();
+    private int blockLen = 0;
+
+    /**
+     * @param dataLen the number of bytes that will be written, so that small tables do not
+     *                allocate full size blocks.
+     */
+    public CompressedDataWriter(DataWriter out, CompressionType compression, long dataLen) {
+      this.out = out;
+      this.codec = (byte) compression.nativeId;
+      int blockSize = scratchBlockSize(dataLen);
+      this.block = new byte[blockSize];
+      this.compressed = new byte[blockSize];
+    }
+
+    @Override
+    public void writeByte(byte b) throws IOException {
+      block[blockLen++] = b;
+      if (blockLen == block.length) {
+        writeBlock();
+      }
+    }
+
+    @Override
+    public void writeShort(short s) throws IOException {
+      writeByte((byte) (s >>> 8));
+      writeByte((byte) s);
+    }
+
+    @Override
+    public void writeInt(int i) throws IOException {
+      writeShort((short) (i >>> 16));
+      writeShort((short) i);
+    }
+
+    @Override
+    public void writeIntNativeOrder(int i) throws IOException {
+      // Same as DataOutputStreamWriter, this only works on Little Endian Architectures.
+      writeInt(Integer.reverseBytes(i));
+    }
+
+    @Override
+    public void writeLong(long val) throws IOException {
+      writeInt((int) (val >>> 32));
+      writeInt((int) val);
+    }
+
+    @Override
+    public void copyDataFrom(HostMemoryBuffer src, long srcOffset, long len) throws IOException {
+      while (len > 0) {
+        int amountToCopy = (int) Math.min(block.length - blockLen, len);
+        src.getBytes(block, blockLen, srcOffset, amountToCopy);
+        blockLen += amountToCopy;
+        srcOffset += amountToCopy;
+        len -= amountToCopy;
+        if (blockLen == block.length) {
+          writeBlock();
+        }
+      }
+    }
+
+    @Override
+    public void write(byte[] arr, int offset, int length) throws IOException {
+      while (length > 0) {
+        int amountToCopy = Math.min(block.length - blockLen, length);
+        System.arraycopy(arr, offset, block, blockLen, amountToCopy);
+        blockLen += amountToCopy;
+        offset += amountToCopy;
+        length -= amountToCopy;
+        if (blockLen == block.length) {
+          writeBlock();
+        }
+      }
+    }
+
+    @Override
+    public void endBuffer() throws IOException {
+      if (blockLen >= MIN_COMPRESSED_BLOCK_SIZE) {
+        writeBlock();
+      }
+    }
+
+    @Override
+    public void flush() throws IOException {
+      if (blockLen > 0) {
+        writeBlock();
+      }
+      out.flush();
+    }
+
+    /** Release the native resources of the compressor. */
+    public void close() {
+      deflater.end();
+    }
+
+    private void writeBlock() throws IOException {
+      crc.reset();
+      crc.update(block, 0, blockLen);
+      deflater.reset();
+      deflater.setInput(block, 0, blockLen);
+      deflater.finish();
+      int compressedLen = 0;
+      while (!deflater.finished() && compressedLen < compressed.length) {
+        compressedLen += deflater.deflate(compressed, compressedLen,
+            compressed.length - compressedLen);
+      }
+      boolean isCompressed = deflater.finished() && compressedLen < blockLen;
+      out.writeByte(isCompressed ? codec : STORED_BLOCK);
+      out.writeInt(blockLen);
+      out.writeInt(isCompressed ? compressedLen : blockLen);
+      out.writeInt((int) crc.getValue());
+      if (isCompressed) {
+        out.write(compressed, 0, compressedLen);
+      } else {
+        out.write(block, 0, blockLen);
+      }
+      blockLen = 0;
+    }
+  }
+
   /////////////////////////////////////////////
   // METHODS
   /////////////////////////////////////////////
@@ -729,9 +1035,120 @@ public class JCudfSerialization {
       out.writeByte((byte)0);
       bytes++;
     }
+    out.endBuffer();
     return paddedBytes;
   }
 
+  /////////////////////////////////////////////
+  // COMPRESSION
+  /////////////////////////////////////////////
+
+  private static void checkSupportedCompression(CompressionType compression) {
+    if (compression != CompressionType.NONE && compression != CompressionType.ZIP) {
+      throw new IllegalArgumentException("Unsupported serialization compression " + compression
+          + ", only NONE and ZIP are supported");
+    }
+  }
+
+  private static CompressionType compressionFromId(int nativeId) {
+    if (nativeId == CompressionType.ZIP.nativeId) {
+      return CompressionType.ZIP;
+    }
+    throw new IllegalStateException("UNSUPPORTED SERIALIZATION COMPRESSION CODEC " + nativeId);
+  }
+
+  /** Writes the data of a table, possibly compressed. */
+  private interface DataWrite {
+    void write(DataWriter out) throws IOException;
+  }
+
+  /**
+   * Size of the scratch arrays for the blocks of a table with dataLen bytes of data. Blocks
+   * never span tables, so there is no need for more than the data.
+   */
+  private static int scratchBlockSize(long dataLen) {
+    return (int) Math.min(dataLen, COMPRESSED_BLOCK_SIZE);
+  }
+
+  private static void writeData(DataWriter out, CompressionType compression, long dataLen,
+                                DataWrite write) throws IOException {
+    if (compression == CompressionType.NONE) {
+      write.write(out);
+      out.flush();
+      return;
+    }
+    CompressedDataWriter compressedOut = new CompressedDataWriter(out, compression, dataLen);
+    try {
+      write.write(compressedOut);
+      compressedOut.flush();
+    } finally {
+      compressedOut.close();
+    }
+  }
+
+  private static void readCompressedData(InputStream in,
+                                         SerializedTableHeader header,
+                                         HostMemoryBuffer buffer) throws IOException {
+    DataInputStream din;
+    if (in instanceof DataInputStream) {
+      din = (DataInputStream) in;
+    } else {
+      din = new DataInputStream(in);
+    }
+    int blockSize = scratchBlockSize(header.dataLen);
+    byte[] block = new byte[blockSize];
+    byte[] compressed = new byte[blockSize];
+    CRC32 crc = new CRC32();
+    Inflater inflater = new Inflater();
+    try {
+      long offset = 0;
+      while (offset < header.dataLen) {
+        byte codec = din.readByte();
+        int blockLen = din.readInt();
+        int compressedLen = din.readInt();
+        int checksum = din.readInt();
+        if (blockLen <= 0 || blockLen > block.length || offset + blockLen > header.dataLen ||
+            compressedLen < 0 || compressedLen > compressed.length ||
+            (codec == STORED_BLOCK && compressedLen != blockLen)) {
+          throw new IOException("Corrupt compressed block at offset " + offset);
+        }
+        if (codec == STORED_BLOCK) {
+          din.readFully(block, 0, blockLen);
+        } else if (codec == header.compression.nativeId) {
+          din.readFully(compressed, 0, compressedLen);
+          inflater.reset();
+          inflater.setInput(compressed, 0, compressedLen);
+          int inflated = 0;
+          try {
+            while (inflated < blockLen && !inflater.finished()) {
+              int amount = inflater.inflate(block, inflated, blockLen - inflated);
+              if (amount == 0 && (inflater.needsInput() || inflater.needsDictionary())) {
+                break;
+              }
+              inflated += amount;
+            }
+          } catch (DataFormatException e) {
+            throw new IOException("Corrupt compressed block at offset " + offset, e);
+          }
+          if (inflated != blockLen) {
+            throw new IOException("Corrupt compressed block at offset " + offset);
+          }
+        } else {
+          throw new IOException("Unexpected codec " + codec + " for block at offset " + offset);
+        }
+        crc.reset();
+        crc.update(block, 0, blockLen);
+        if ((int) crc.getValue() != checksum) {
+          throw new IOException("Checksum mismatch for block at offset " + offset);
+        }
+        buffer.setBytes(offset, block, 0, blockLen);
+        offset += blockLen;
+      }
+    } finally {
+      inflater.end();
+    }
+  }
+
   /////////////////////////////////////////////
   // SERIALIZED SIZE
   /////////////////////////////////////////////
@@ -935,43 +1352,45 @@ public class JCudfSerialization {
    * top column index to the corresponding column providers for that column across all tables.
    */
   private static ColumnBufferProvider[][] providersFrom(SerializedTableHeader[] headers,
-                                                        HostMemoryBuffer[] dataBuffers) {
-    int numColumns = 0;
+                                                        HostMemoryBuffer[] dataBuffers)
+      throws IOException {
     int numTables = headers.length;
-    int numNonEmptyTables = 0;
-    ArrayList<ArrayList<ColumnBufferProvider>> providersPerColumn = null;
+    int numColumns = numTables > 0 ? headers[0].getNumColumns() : 0;
+    List<Integer> nonEmptyTables = new ArrayList<>(numTables);
     for (int tableIdx = 0; tableIdx < numTables; tableIdx++) {
-      SerializedTableHeader header = headers[tableIdx];
-      if (tableIdx == 0) {
-        numColumns = header.getNumColumns();
-        providersPerColumn = new ArrayList<>(numColumns);
-        for (int i = 0; i < numColumns; i++) {
-          providersPerColumn.add(new ArrayList<>(numTables));
-        }
-      } else {
-        checkCompatibleTypes(headers[0], header, tableIdx);
+      if (tableIdx > 0) {
+        checkCompatibleTypes(headers[0], headers[tableIdx], tableIdx);
       }
       // filter out empty tables but keep at least one if all were empty
       if (headers[tableIdx].getNumRows() > 0 ||
-          (numNonEmptyTables == 0 && tableIdx == numTables - 1)) {
-        numNonEmptyTables++;
-        HostMemoryBuffer dataBuffer = dataBuffers[tableIdx];
-        ArrayDeque<ColumnOffsets> offsets = buildIndex(header, dataBuffer);
-        for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
-          ColumnBufferProvider provider = buildBufferOffsetProvider(
-              header.getColumnHeader(columnIdx), offsets, dataBuffer);
-          providersPerColumn.get(columnIdx).add(provider);
-        }
-        assert offsets.isEmpty();
+          (nonEmptyTables.isEmpty() && tableIdx == numTables - 1)) {
+        nonEmptyTables.add(tableIdx);
       } else {
         assert headers[tableIdx].dataLen == 0;
       }
     }
 
-    ColumnBufferProvider[][] result = new ColumnBufferProvider[numColumns][];
-    for (int i = 0; i < numColumns; i++) {
-      result[i] = providersPerColumn.get(i).toArray(new ColumnBufferProvider[0]);
+    int numNonEmptyTables = nonEmptyTables.size();
+    ColumnBufferProvider[][] result = new ColumnBufferProvider[numColumns][numNonEmptyTables];
+    List<ConcatTask> tasks = new ArrayList<>();
+    for (int first = 0; first < numNonEmptyTables; first += CONCAT_TABLES_PER_TASK) {
+      final int rangeFirst = first;
+      final int rangeLast = Math.min(first + CONCAT_TABLES_PER_TASK, numNonEmptyTables);
+      tasks.add(() -> {
+        for (int i = rangeFirst; i < rangeLast; i++) {
+          int tableIdx = nonEmptyTables.get(i);
+          SerializedTableHeader header = headers[tableIdx];
+          HostMemoryBuffer dataBuffer = dataBuffers[tableIdx];
+          ArrayDeque<ColumnOffsets> offsets = buildIndex(header, dataBuffer);
+          for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
+            result[columnIdx][i] = buildBufferOffsetProvider(
+                header.getColumnHeader(columnIdx), offsets, dataBuffer);
+          }
+          assert offsets.isEmpty();
+        }
+      });
     }
+    runConcatTasks(tasks, true);
     return result;
   }
 
@@ -1045,20 +1464,34 @@ public class JCudfSerialization {
    * @param providersPerColumn first index is the column, second index is the table.
    * @return the new header.
    */
-  private static SerializedTableHeader calcConcatHeader(ColumnBufferProvider[][] providersPerColumn) {
+  private static SerializedTableHeader calcConcatHeader(ColumnBufferProvider[][] providersPerColumn)
+      throws IOException {
     int numColumns = providersPerColumn.length;
+    SerializedColumnHeader[] columnHeaders = new SerializedColumnHeader[numColumns];
+    long[] columnSizes = new long[numColumns];
+    List<ConcatTask> tasks = new ArrayList<>(numColumns);
+    for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
+      final int idx = columnIdx;
+      tasks.add(() -> {
+        ArrayList<SerializedColumnHeader> headers = new ArrayList<>(1);
+        columnSizes[idx] = calcConcatColumnHeaderAndSize(headers, providersPerColumn[idx]);
+        columnHeaders[idx] = headers.get(0);
+      });
+    }
+    // Each task goes through all of the tables, so only use threads for many tables
+    runConcatTasks(tasks,
+        numColumns > 0 && providersPerColumn[0].length >= CONCAT_TABLES_PER_TASK);
+
     long rowCount = 0;
     long totalDataSize = 0;
-    ArrayList<SerializedColumnHeader> headers = new ArrayList<>(numColumns);
     for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
-      totalDataSize += calcConcatColumnHeaderAndSize(headers, providersPerColumn[columnIdx]);
+      totalDataSize += columnSizes[columnIdx];
       if (columnIdx == 0) {
-        rowCount = headers.get(0).getRowCount();
+        rowCount = columnHeaders[0].getRowCount();
       } else {
-        assert rowCount == headers.get(columnIdx).getRowCount();
+        assert rowCount == columnHeaders[columnIdx].getRowCount();
       }
     }
-    SerializedColumnHeader[] columnHeaders = headers.toArray(new SerializedColumnHeader[0]);
     return new SerializedTableHeader(columnHeaders, (int)rowCount, totalDataSize);
   }
 
@@ -1138,6 +1571,10 @@ public class JCudfSerialization {
     return new HostDataWriter(buffer);
   }
 
+  private static DataWriter writerFrom(WritableByteChannel channel) {
+    return new ChannelDataWriter(channel);
+  }
+
   /////////////////////////////////////////////
   // Serialize Data Methods
   /////////////////////////////////////////////
@@ -1544,7 +1981,8 @@ public class JCudfSerialization {
   private static void writeSliced(ColumnBufferProvider[] columns,
                                   DataWriter out,
                                   long rowOffset,
-                                  long numRows) throws IOException {
+                                  long numRows,
+                                  CompressionType compression) throws IOException {
     assert rowOffset >= 0;
     assert numRows >= 0;
     for (int i = 0; i < columns.length; i++) {
@@ -1556,14 +1994,16 @@ public class JCudfSerialization {
     }
 
     SerializedTableHeader header = calcHeader(columns, rowOffset, (int) numRows);
+    header.compression = compression;
     header.writeTo(out);
 
     try (NvtxRange range = new NvtxRange("Write Sliced", NvtxColor.GREEN)) {
-      for (int i = 0; i < columns.length; i++) {
-        writeSliced(out, columns[i], rowOffset, numRows);
-      }
+      writeData(out, compression, header.dataLen, dataOut -> {
+        for (int i = 0; i < columns.length; i++) {
+          writeSliced(dataOut, columns[i], rowOffset, numRows);
+        }
+      });
     }
-    out.flush();
   }
 
   /**
@@ -1578,6 +2018,19 @@ public class JCudfSerialization {
     writeToStream(t.getColumns(), out, rowOffset, numRows);
   }
 
+  /**
+   * Write all or part of a table out in an internal format, optionally compressing the data.
+   * @param t the table to be written.
+   * @param out the stream to write the serialized table out to.
+   * @param rowOffset the first row to write out.
+   * @param numRows the number of rows to write out.
+   * @param compression NONE, or ZIP to compress the data with DEFLATE.
+   */
+  public static void writeToStream(Table t, OutputStream out, long rowOffset, long numRows,
+                                   CompressionType compression) throws IOException {
+    writeToStream(t.getColumns(), out, rowOffset, numRows, compression);
+  }
+
   /**
    * Write all or part of a set of columns out in an internal format.
    * @param columns the columns to be written.
@@ -1587,11 +2040,25 @@ public class JCudfSerialization {
    */
   public static void writeToStream(ColumnVector[] columns, OutputStream out, long rowOffset,
                                    long numRows) throws IOException {
+    writeToStream(columns, out, rowOffset, numRows, CompressionType.NONE);
+  }
 
+  /**
+   * Write all or part of a set of columns out in an internal format, optionally compressing
+   * the data.
+   * @param columns the columns to be written.
+   * @param out the stream to write the serialized table out to.
+   * @param rowOffset the first row to write out.
+   * @param numRows the number of rows to write out.
+   * @param compression NONE, or ZIP to compress the data with DEFLATE.
+   */
+  public static void writeToStream(ColumnVector[] columns, OutputStream out, long rowOffset,
+                                   long numRows, CompressionType compression) throws IOException {
+    checkSupportedCompression(compression);
     ColumnBufferProvider[] providers = providersFrom(columns);
     try {
       DataWriter writer = writerFrom(out);
-      writeSliced(providers, writer, rowOffset, numRows);
+      writeSliced(providers, writer, rowOffset, numRows, compression);
     } finally {
       closeAll(providers);
     }
@@ -1606,11 +2073,47 @@ public class JCudfSerialization {
    */
   public static void writeToStream(HostColumnVector[] columns, OutputStream out, long rowOffset,
                                    long numRows) throws IOException {
+    writeToStream(columns, out, rowOffset, numRows, CompressionType.NONE);
+  }
 
+  /**
+   * Write all or part of a set of columns out in an internal format, optionally compressing
+   * the data.
+   * @param columns the columns to be written.
+   * @param out the stream to write the serialized table out to.
+   * @param rowOffset the first row to write out.
+   * @param numRows the number of rows to write out.
+   * @param compression NONE, or ZIP to compress the data with DEFLATE.
+   */
+  public static void writeToStream(HostColumnVector[] columns, OutputStream out, long rowOffset,
+                                   long numRows, CompressionType compression) throws IOException {
+    checkSupportedCompression(compression);
     ColumnBufferProvider[] providers = providersFrom(columns, false);
     try {
       DataWriter writer = writerFrom(out);
-      writeSliced(providers, writer, rowOffset, numRows);
+      writeSliced(providers, writer, rowOffset, numRows, compression);
+    } finally {
+      closeAll(providers);
+    }
+  }
+
+  /**
+   * Write all or part of a set of columns out in an internal format to a blocking channel.
+   * Without compression, large column buffers are passed to the channel without being copied.
+   * @param columns the columns to be written.
+   * @param out the channel to write the serialized table out to.
+   * @param rowOffset the first row to write out.
+   * @param numRows the number of rows to write out.
+   * @param compression NONE, or ZIP to compress the data with DEFLATE.
+   */
+  public static void writeToChannel(HostColumnVector[] columns, WritableByteChannel out,
+                                    long rowOffset, long numRows,
+                                    CompressionType compression) throws IOException {
+    checkSupportedCompression(compression);
+    ColumnBufferProvider[] providers = providersFrom(columns, false);
+    try {
+      DataWriter writer = writerFrom(out);
+      writeSliced(providers, writer, rowOffset, numRows, compression);
     } finally {
       closeAll(providers);
     }
@@ -1640,24 +2143,284 @@ public class JCudfSerialization {
   public static void writeConcatedStream(SerializedTableHeader[] headers,
                                          HostMemoryBuffer[] dataBuffers,
                                          OutputStream out) throws IOException {
+    writeConcatedStream(headers, dataBuffers, out, CompressionType.NONE);
+  }
+
+  /**
+   * Take the data from multiple batches stored in the parsed headers and the dataBuffer and write
+   * it out to out as if it were a single buffer, optionally compressing the data.
+   * @param headers the headers parsed from multiple streams.
+   * @param dataBuffers an array of buffers that hold the data, one per header.
+   * @param out what to write the data out to.
+   * @param compression NONE, or ZIP to compress the data with DEFLATE.
+   * @throws IOException on any error.
+   */
+  public static void writeConcatedStream(SerializedTableHeader[] headers,
+                                         HostMemoryBuffer[] dataBuffers,
+                                         OutputStream out,
+                                         CompressionType compression) throws IOException {
+    checkSupportedCompression(compression);
     ColumnBufferProvider[][] providersPerColumn = providersFrom(headers, dataBuffers);
     try {
       SerializedTableHeader combined = calcConcatHeader(providersPerColumn);
+      combined.compression = compression;
       DataWriter writer = writerFrom(out);
       combined.writeTo(writer);
       try (NvtxRange range = new NvtxRange("Concat Host Side", NvtxColor.GREEN)) {
-        int numColumns = combined.getNumColumns();
-        for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
-          ColumnBufferProvider[] providers = providersPerColumn[columnIdx];
-          writeConcat(writer, combined.getColumnHeader(columnIdx), providersPerColumn[columnIdx]);
-        }
+        writeData(writer, compression, combined.dataLen, dataOut -> {
+          int numColumns = combined.getNumColumns();
+          for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
+            writeConcat(dataOut, combined.getColumnHeader(columnIdx),
+                providersPerColumn[columnIdx]);
+          }
+        });
       }
-      writer.flush();
     } finally {
       closeAll(providersPerColumn);
     }
   }
 
+  /////////////////////////////////////////////
+  // PARALLEL HOST CONCAT
+  /////////////////////////////////////////////
+
+  /** Threads for the host concatenation, created on first use. */
+  private static final class ConcatThreads {
+    private static final int NUM_THREADS = Integer.getInteger(
+        "ai.rapids.cudf.serialization.concatThreads", Runtime.getRuntime().availableProcessors());
+    private static final ExecutorService POOL = NUM_THREADS <= 1 ? null :
+        Executors.newFixedThreadPool(NUM_THREADS, runnable -> {
+          Thread t = new Thread(runnable, "host concat");
+          t.setDaemon(true);
+          return t;
+        });
+  }
+
+  /** A part of a host concatenation that can run concurrently with the other parts. */
+  private interface ConcatTask {
+    void run() throws IOException;
+  }
+
+  /** A copy of the part of a column buffer that comes from a range of the tables. */
+  private interface TableRangeCopy {
+    void copy(int firstTable, int lastTable);
+  }
+
+  /**
+   * Run tasks on the concatenation threads and wait for all of them, rethrowing the first error.
+   * Once a task fails the tasks that did not start yet are skipped.
+   */
+  private static void runConcatTasks(List<ConcatTask> tasks, boolean parallel)
+      throws IOException {
+    ExecutorService pool = parallel && tasks.size() > 1 ? ConcatThreads.POOL : null;
+    if (pool == null) {
+      for (ConcatTask task : tasks) {
+        task.run();
+      }
+      return;
+    }
+    AtomicBoolean failed = new AtomicBoolean(false);
+    List<Future<?>> futures = new ArrayList<>(tasks.size());
+    for (ConcatTask task : tasks) {
+      futures.add(pool.submit(() -> {
+        if (!failed.get()) {
+          try {
+            task.run();
+          } catch (IOException | RuntimeException | Error e) {
+            failed.set(true);
+            throw e;
+          }
+        }
+        return null;
+      }));
+    }
+    // Always wait for all of the tasks, the caller may free the buffers once this returns
+    Throwable error = null;
+    boolean interrupted = false;
+    for (Future<?> future : futures) {
+      while (true) {
+        try {
+          future.get();
+          break;
+        } catch (InterruptedException e) {
+          interrupted = true;
+          failed.set(true);
+        } catch (ExecutionException e) {
+          if (error == null) {
+            error = e.getCause();
+          }
+          break;
+        }
+      }
+    }
+    if (interrupted) {
+      Thread.currentThread().interrupt();
+      if (error == null) {
+        error = new InterruptedIOException("Interrupted while concatenating tables");
+      }
+    }
+    if (error instanceof IOException) {
+      throw (IOException) error;
+    } else if (error instanceof RuntimeException) {
+      throw (RuntimeException) error;
+    } else if (error instanceof Error) {
+      throw (Error) error;
+    } else if (error != null) {
+      throw new RuntimeException(error);
+    }
+  }
+
+  /**
+   * Split the tables into ranges holding about CONCAT_TASK_BYTES of a buffer, and add a task
+   * copying each range.
+   */
+  private static void addTableRangeTasks(List<ConcatTask> tasks, long[] bytesPerTable,
+                                         TableRangeCopy copy) {
+    int first = 0;
+    long bytes = 0;
+    for (int tableIdx = 0; tableIdx < bytesPerTable.length; tableIdx++) {
+      bytes += bytesPerTable[tableIdx];
+      if (bytes >= CONCAT_TASK_BYTES || tableIdx == bytesPerTable.length - 1) {
+        final int rangeFirst = first;
+        final int rangeLast = tableIdx + 1;
+        tasks.add(() -> copy.copy(rangeFirst, rangeLast));
+        first = tableIdx + 1;
+        bytes = 0;
+      }
+    }
+  }
+
+  /**
+   * Add the tasks writing a concatenated column and its children to a host buffer, with the
+   * same layout as writeConcat. Tables are split into ranges that are copied concurrently, and
+   * the offsets of each range are rebased using the rows and data of the preceding tables.
+   * Validity is copied by a single task per column as tables do not start at byte boundaries.
+   * @return the buffer offset at the end of the column data including its children
+   */
+  private static long addConcatTasks(List<ConcatTask> tasks, HostMemoryBuffer out, long offset,
+                                     SerializedColumnHeader header,
+                                     ColumnBufferProvider[] providers) {
+    final int numTables = providers.length;
+    final long rowCount = header.getRowCount();
+    if (header.getNullCount() > 0) {
+      final long validityOffset = offset;
+      tasks.add(() -> concatValidity(new HostDataWriter(out, validityOffset), rowCount, providers));
+      offset += padFor64byteAlignment(BitVectorHelper.getValidityLengthInBytes(rowCount));
+    }
+
+    DType dtype = header.getType();
+    if (dtype.hasOffsets()) {
+      if (rowCount > 0) {
+        // rows and offset values of the preceding tables
+        long[] rowsBefore = new long[numTables];
+        long[] valuesBefore = new long[numTables];
+        long[] offsetBytes = new long[numTables];
+        long[] valueBytes = new long[numTables];
+        long rows = 0;
+        long values = 0;
+        for (int tableIdx = 0; tableIdx < numTables; tableIdx++) {
+          ColumnBufferProvider provider = providers[tableIdx];
+          long tableRows = provider.getRowCount();
+          rowsBefore[tableIdx] = rows;
+          valuesBefore[tableIdx] = values;
+          if (tableRows > 0) {
+            offsetBytes[tableIdx] = tableRows * Integer.BYTES;
+            valueBytes[tableIdx] = provider.getOffset(tableRows);
+          }
+          rows += tableRows;
+          values += valueBytes[tableIdx];
+        }
+
+        final long offsetsOffset = offset;
+        final long offsetsLen = (rowCount + 1) * Integer.BYTES;
+        offset += padFor64byteAlignment(offsetsLen);
+        zeroPadding(out, offsetsOffset, offsetsLen);
+        addTableRangeTasks(tasks, offsetBytes, (firstTable, lastTable) -> {
+          for (int tableIdx = firstTable; tableIdx < lastTable; tableIdx++) {
+            ColumnBufferProvider provider = providers[tableIdx];
+            long tableRows = provider.getRowCount();
+            if (tableRows > 0) {
+              HostMemoryBuffer src = provider.getHostBufferFor(BufferType.OFFSET);
+              long srcOffset = provider.getBufferStartOffset(BufferType.OFFSET);
+              int valueToAdd = (int) valuesBefore[tableIdx];
+              // the first offset of a table is the last one of the preceding tables
+              long firstRow = rowsBefore[tableIdx] == 0 ? 0 : 1;
+              long destOffset = offsetsOffset + (rowsBefore[tableIdx] + firstRow) * Integer.BYTES;
+              if (valueToAdd == 0) {
+                out.copyFromHostBuffer(destOffset, src, srcOffset + firstRow * Integer.BYTES,
+                    (tableRows + 1 - firstRow) * Integer.BYTES);
+              } else {
+                for (long row = firstRow; row <= tableRows; row++) {
+                  out.setInt(destOffset, src.getInt(srcOffset + row * Integer.BYTES) + valueToAdd);
+                  destOffset += Integer.BYTES;
+                }
+              }
+            }
+          }
+        });
+
+        if (dtype.equals(DType.STRING)) {
+          final long dataOffset = offset;
+          offset += padFor64byteAlignment(values);
+          zeroPadding(out, dataOffset, values);
+          addTableRangeTasks(tasks, valueBytes, (firstTable, lastTable) -> {
+            for (int tableIdx = firstTable; tableIdx < lastTable; tableIdx++) {
+              ColumnBufferProvider provider = providers[tableIdx];
+              if (valueBytes[tableIdx] > 0) {
+                out.copyFromHostBuffer(dataOffset + valuesBefore[tableIdx],
+                    provider.getHostBufferFor(BufferType.DATA),
+                    provider.getBufferStartOffset(BufferType.DATA), valueBytes[tableIdx]);
+              }
+            }
+          });
+        }
+      }
+    } else if (dtype.getSizeInBytes() > 0) {
+      final long sizeInBytes = dtype.getSizeInBytes();
+      final long dataOffset = offset;
+      final long dataLen = sizeInBytes * rowCount;
+      offset += padFor64byteAlignment(dataLen);
+      zeroPadding(out, dataOffset, dataLen);
+      long[] rowsBefore = new long[numTables];
+      long[] dataBytes = new long[numTables];
+      long rows = 0;
+      for (int tableIdx = 0; tableIdx < numTables; tableIdx++) {
+        rowsBefore[tableIdx] = rows;
+        rows += providers[tableIdx].getRowCount();
+        dataBytes[tableIdx] = providers[tableIdx].getRowCount() * sizeInBytes;
+      }
+      addTableRangeTasks(tasks, dataBytes, (firstTable, lastTable) -> {
+        for (int tableIdx = firstTable; tableIdx < lastTable; tableIdx++) {
+          ColumnBufferProvider provider = providers[tableIdx];
+          if (dataBytes[tableIdx] > 0) {
+            out.copyFromHostBuffer(dataOffset + rowsBefore[tableIdx] * sizeInBytes,
+                provider.getHostBufferFor(BufferType.DATA),
+                provider.getBufferStartOffset(BufferType.DATA), dataBytes[tableIdx]);
+          }
+        }
+      });
+    }
+
+    if (dtype.isNestedType()) {
+      SerializedColumnHeader[] childHeaders = header.getChildren();
+      for (int childIdx = 0; childIdx < childHeaders.length; childIdx++) {
+        ColumnBufferProvider[] childColumnProviders = new ColumnBufferProvider[numTables];
+        for (int tableIdx = 0; tableIdx < numTables; tableIdx++) {
+          childColumnProviders[tableIdx] = providers[tableIdx].getChildProviders()[childIdx];
+        }
+        offset = addConcatTasks(tasks, out, offset, childHeaders[childIdx], childColumnProviders);
+      }
+    }
+    return offset;
+  }
+
+  private static void zeroPadding(HostMemoryBuffer out, long offset, long length) {
+    long paddedLength = padFor64byteAlignment(length);
+    if (paddedLength > length) {
+      out.setMemory(offset + length, paddedLength - length, (byte) 0);
+    }
+  }
+
   /////////////////////////////////////////////
   // COLUMN AND TABLE READ
   /////////////////////////////////////////////
@@ -1808,10 +2571,22 @@ public class JCudfSerialization {
       HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(combined.dataLen);
       try {
         try (NvtxRange range = new NvtxRange("Concat Host Side", NvtxColor.GREEN)) {
-          DataWriter writer = writerFrom(hostBuffer);
           int numColumns = combined.getNumColumns();
-          for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
-            writeConcat(writer, combined.getColumnHeader(columnIdx), providersPerColumn[columnIdx]);
+          if (combined.dataLen >= MIN_PARALLEL_CONCAT_BYTES) {
+            List<ConcatTask> tasks = new ArrayList<>();
+            long offset = 0;
+            for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
+              offset = addConcatTasks(tasks, hostBuffer, offset,
+                  combined.getColumnHeader(columnIdx), providersPerColumn[columnIdx]);
+            }
+            assert offset == combined.dataLen;
+            runConcatTasks(tasks, true);
+          } else {
+            DataWriter writer = writerFrom(hostBuffer);
+            for (int columnIdx = 0; columnIdx < numColumns; columnIdx++) {
+              writeConcat(writer, combined.getColumnHeader(columnIdx),
+                  providersPerColumn[columnIdx]);
+            }
           }
         }
       } catch (Exception e) {
@@ -1872,7 +2647,11 @@ public class JCudfSerialization {
     if (header.initialized &&
         (buffer.length >= header.dataLen)) {
       try (NvtxRange range = new NvtxRange("Read Data", NvtxColor.RED)) {
-        buffer.copyFromStream(0, in, header.dataLen);
+        if (header.compression == CompressionType.NONE) {
+          buffer.copyFromStream(0, in, header.dataLen);
+        } else {
+          readCompressedData(in, header, buffer);
+        }
       }
       header.dataRead = true;
     }
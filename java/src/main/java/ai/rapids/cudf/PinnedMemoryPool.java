@@ -22,15 +22,25 @@ package ai.rapids.cudf;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.lang.ref.WeakReference;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
 import java.util.Comparator;
+import java.util.HashMap;
 import java.util.Iterator;
+import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.Optional;
+import java.util.Queue;
 import java.util.SortedSet;
 import java.util.TreeSet;
+import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 
 /**
  * This provides a pool of pinned memory similar to what RMM does for device memory.
@@ -38,6 +48,33 @@ import java.util.concurrent.Future;
 public final class PinnedMemoryPool implements AutoCloseable {
   private static final Logger log = LoggerFactory.getLogger(PinnedMemoryPool.class);
   private static final long ALIGNMENT = 8;
+  // Size classes of the SIZE_CLASS mode, with 4 classes per doubling from 64 bytes to 1 MiB
+  private static final long MIN_SIZE_CLASS = 64;
+  private static final long MAX_SIZE_CLASS = 1024 * 1024;
+  private static final int SIZE_CLASSES_PER_DOUBLING = 4;
+  private static final int NUM_SIZE_CLASSES = sizeClassOf(MAX_SIZE_CLASS) + 1;
+  // Upper bound of the bytes held by the cache of a thread
+  private static final long MAX_THREAD_CACHE_BYTES = 4 * 1024 * 1024;
+  // Sections of a size class fetched together when the cache of a thread is empty
+  private static final long REFILL_BYTES = 64 * 1024;
+  private static final int MAX_REFILL_COUNT = 16;
+
+  /**
+   * How the pool finds free memory for an allocation.
+   */
+  public enum AllocatorMode {
+    /**
+     * Free sections are kept sorted by address and searched for the first one large enough,
+     * under a single lock.
+     */
+    FIRST_FIT,
+    /**
+     * Allocations of up to 1 MiB are rounded up to size classes and served from a cache per
+     * thread. Larger allocations and cache refills take the smallest free section large enough,
+     * found in O(log n), and freed sections are coalesced with their neighbors in constant time.
+     */
+    SIZE_CLASS
+  }
 
   // These static fields should only ever be accessed when class-synchronized.
   // Do NOT use singleton_ directly!  Use the getSingleton accessor instead.
@@ -45,9 +82,18 @@ public final class PinnedMemoryPool implements AutoCloseable {
   private static Future<PinnedMemoryPool> initFuture = null;
 
   private final long pinnedPoolBase;
+  private final long poolSize;
+  private final AllocatorMode mode;
+  // Free sections of the FIRST_FIT mode, guarded by the pool lock
   private final SortedSet<MemorySection> freeHeap = new TreeSet<>(new SortedByAddress());
-  private int numAllocatedSections = 0;
-  private long availableBytes;
+  // Free sections of the SIZE_CLASS mode, outside of the thread caches
+  private final BestFitHeap bestFitHeap = new BestFitHeap();
+  private final ThreadLocal<ThreadCache> threadCaches;
+  private final Queue<ThreadCache> allThreadCaches = new ConcurrentLinkedQueue<>();
+  private final long threadCacheLimit;
+  private final AtomicLong cachedBytes = new AtomicLong();
+  private final AtomicInteger numAllocatedSections = new AtomicInteger();
+  private final AtomicLong availableBytes;
 
   private static class SortedBySize implements Comparator<MemorySection> {
     @Override
@@ -63,6 +109,14 @@ public final class PinnedMemoryPool implements AutoCloseable {
     }
   }
 
+  private static class SortedBySizeThenAddress implements Comparator<MemorySection> {
+    @Override
+    public int compare(MemorySection s0, MemorySection s1) {
+      int ret = Long.compare(s0.size, s1.size);
+      return ret != 0 ? ret : Long.compare(s0.baseAddress, s1.baseAddress);
+    }
+  }
+
   private static class MemorySection {
     private long baseAddress;
     private long size;
@@ -102,6 +156,216 @@ public final class PinnedMemoryPool implements AutoCloseable {
     }
   }
 
+  /**
+   * Free sections indexed by size, for best-fit searches, and by their start and end addresses.
+   * The address indexes are the boundary tags that find the free neighbors of a freed section.
+   */
+  private static final class BestFitHeap {
+    private final TreeSet<MemorySection> bySize = new TreeSet<>(new SortedBySizeThenAddress());
+    private final Map<Long, MemorySection> byStart = new HashMap<>();
+    private final Map<Long, MemorySection> byEnd = new HashMap<>();
+    private long freeBytes = 0;
+
+    synchronized MemorySection allocate(long size) {
+      MemorySection best = bySize.ceiling(new MemorySection(Long.MIN_VALUE, size));
+      if (best == null) {
+        return null;
+      }
+      remove(best);
+      if (best.size == size) {
+        return best;
+      }
+      MemorySection allocated = best.splitOff(size);
+      add(best);
+      return allocated;
+    }
+
+    synchronized void free(MemorySection section) {
+      freeCoalesced(section);
+    }
+
+    synchronized void freeAll(List<MemorySection> sections) {
+      for (MemorySection section : sections) {
+        freeCoalesced(section);
+      }
+    }
+
+    synchronized long getFreeBytes() {
+      return freeBytes;
+    }
+
+    synchronized long getLargestFreeBlock() {
+      return bySize.isEmpty() ? 0 : bySize.last().size;
+    }
+
+    synchronized int getNumFreeBlocks() {
+      return bySize.size();
+    }
+
+    private void freeCoalesced(MemorySection section) {
+      MemorySection before = byEnd.get(section.baseAddress);
+      if (before != null) {
+        remove(before);
+        section.combineWith(before);
+      }
+      MemorySection after = byStart.get(section.baseAddress + section.size);
+      if (after != null) {
+        remove(after);
+        section.combineWith(after);
+      }
+      add(section);
+    }
+
+    private void add(MemorySection section) {
+      bySize.add(section);
+      byStart.put(section.baseAddress, section);
+      byEnd.put(section.baseAddress + section.size, section);
+      freeBytes += section.size;
+    }
+
+    private void remove(MemorySection section) {
+      bySize.remove(section);
+      byStart.remove(section.baseAddress);
+      byEnd.remove(section.baseAddress + section.size);
+      freeBytes -= section.size;
+    }
+  }
+
+  /**
+   * Free sections of each size class kept by a thread, so that most small allocations and frees
+   * do not contend on the shared heap. Other threads only lock it to reclaim the sections when
+   * the heap cannot satisfy an allocation.
+   */
+  private final class ThreadCache {
+    private final WeakReference<Thread> owner = new WeakReference<>(Thread.currentThread());
+    private final List<ArrayDeque<MemorySection>> bins = new ArrayList<>(NUM_SIZE_CLASSES);
+    private long bytes = 0;
+
+    ThreadCache() {
+      for (int i = 0; i < NUM_SIZE_CLASSES; i++) {
+        bins.add(new ArrayDeque<>());
+      }
+    }
+
+    synchronized MemorySection take(int sizeClass) {
+      MemorySection section = bins.get(sizeClass).pollLast();
+      if (section != null) {
+        bytes -= section.size;
+        cachedBytes.addAndGet(-section.size);
+      }
+      return section;
+    }
+
+    synchronized boolean offer(MemorySection section) {
+      if (bytes + section.size > threadCacheLimit) {
+        return false;
+      }
+      bins.get(sizeClassOf(section.size)).addLast(section);
+      bytes += section.size;
+      cachedBytes.addAndGet(section.size);
+      return true;
+    }
+
+    synchronized List<MemorySection> drain() {
+      List<MemorySection> sections = new ArrayList<>();
+      for (ArrayDeque<MemorySection> bin : bins) {
+        sections.addAll(bin);
+        bin.clear();
+      }
+      cachedBytes.addAndGet(-bytes);
+      bytes = 0;
+      return sections;
+    }
+
+    boolean isOwnerAlive() {
+      Thread thread = owner.get();
+      return thread != null && thread.isAlive();
+    }
+  }
+
+  /**
+   * Snapshot of the occupancy of the pool.
+   */
+  public static final class Metrics {
+    private final long poolSize;
+    private final long allocatedBytes;
+    private final long cachedBytes;
+    private final long freeBytes;
+    private final long largestFreeBlock;
+    private final int numFreeBlocks;
+    private final int numAllocations;
+
+    private Metrics(long poolSize, long allocatedBytes, long cachedBytes, long freeBytes,
+        long largestFreeBlock, int numFreeBlocks, int numAllocations) {
+      this.poolSize = poolSize;
+      this.allocatedBytes = allocatedBytes;
+      this.cachedBytes = cachedBytes;
+      this.freeBytes = freeBytes;
+      this.largestFreeBlock = largestFreeBlock;
+      this.numFreeBlocks = numFreeBlocks;
+      this.numAllocations = numAllocations;
+    }
+
+    /** Size of the pool in bytes. */
+    public long getPoolSize() {
+      return poolSize;
+    }
+
+    /** Bytes held by outstanding allocations, including the rounding to size classes. */
+    public long getAllocatedBytes() {
+      return allocatedBytes;
+    }
+
+    /** Free bytes held in the caches of the threads. */
+    public long getCachedBytes() {
+      return cachedBytes;
+    }
+
+    /** Free bytes outside of the thread caches. */
+    public long getFreeBytes() {
+      return freeBytes;
+    }
+
+    /** Size of the largest free section in bytes, the largest allocation that can succeed. */
+    public long getLargestFreeBlock() {
+      return largestFreeBlock;
+    }
+
+    /** Number of free sections outside of the thread caches. */
+    public int getNumFreeBlocks() {
+      return numFreeBlocks;
+    }
+
+    /** Number of outstanding allocations. */
+    public int getNumAllocations() {
+      return numAllocations;
+    }
+
+    /** Fraction of the pool held by outstanding allocations. */
+    public double getOccupancy() {
+      return poolSize == 0 ? 0 : (double) allocatedBytes / poolSize;
+    }
+
+    /**
+     * Fraction of the free bytes, outside of the thread caches, that are not part of the largest
+     * free section. 0 when all the free memory is contiguous.
+     */
+    public double getFragmentation() {
+      return freeBytes == 0 ? 0 : 1 - (double) largestFreeBlock / freeBytes;
+    }
+
+    @Override
+    public String toString() {
+      return "PinnedMemoryPool.Metrics{poolSize=" + poolSize +
+          ", allocatedBytes=" + allocatedBytes +
+          ", cachedBytes=" + cachedBytes +
+          ", freeBytes=" + freeBytes +
+          ", largestFreeBlock=" + largestFreeBlock +
+          ", numFreeBlocks=" + numFreeBlocks +
+          ", numAllocations=" + numAllocations + "}";
+    }
+  }
+
   private static final class PinnedHostBufferCleaner extends MemoryBuffer.MemoryBufferCleaner {
     private MemorySection section;
     private final long origLength;
@@ -180,6 +444,17 @@ public final class PinnedMemoryPool implements AutoCloseable {
    * @param gpuId    gpu id to set to get memory pool from, -1 means to use default
    */
   public static synchronized void initialize(long poolSize, int gpuId) {
+    initialize(poolSize, gpuId, AllocatorMode.FIRST_FIT);
+  }
+
+  /**
+   * Initialize the pool.
+   *
+   * @param poolSize size of the pool to initialize.
+   * @param gpuId    gpu id to set to get memory pool from, -1 means to use default
+   * @param mode     how the pool finds free memory for allocations
+   */
+  public static synchronized void initialize(long poolSize, int gpuId, AllocatorMode mode) {
     if (isInitialized()) {
       throw new IllegalStateException("Can only initialize the pool once.");
     }
@@ -188,7 +463,7 @@ public final class PinnedMemoryPool implements AutoCloseable {
       t.setDaemon(true);
       return t;
     });
-    initFuture = initService.submit(() -> new PinnedMemoryPool(poolSize, gpuId));
+    initFuture = initService.submit(() -> new PinnedMemoryPool(poolSize, gpuId, mode));
     initService.shutdown();
   }
 
@@ -254,24 +529,192 @@ public final class PinnedMemoryPool implements AutoCloseable {
     return 0;
   }
 
-  private PinnedMemoryPool(long poolSize, int gpuId) {
+  /**
+   * Get a snapshot of the occupancy and fragmentation of the pinned memory pool.
+   *
+   * @return the metrics of the pool or null if the pool is not initialized
+   */
+  public static Metrics getMetrics() {
+    PinnedMemoryPool pool = getSingleton();
+    if (pool != null) {
+      return pool.getMetricsInternal();
+    }
+    return null;
+  }
+
+  private PinnedMemoryPool(long poolSize, int gpuId, AllocatorMode mode) {
     if (gpuId > -1) {
       // set the gpu device to use
       Cuda.setDevice(gpuId);
       Cuda.freeZero();
     }
     this.pinnedPoolBase = Cuda.hostAllocPinned(poolSize);
-    freeHeap.add(new MemorySection(pinnedPoolBase, poolSize));
-    this.availableBytes = poolSize;
+    this.poolSize = poolSize;
+    this.mode = mode;
+    if (mode == AllocatorMode.SIZE_CLASS) {
+      bestFitHeap.free(new MemorySection(pinnedPoolBase, poolSize));
+      this.threadCaches = ThreadLocal.withInitial(() -> {
+        ThreadCache cache = new ThreadCache();
+        allThreadCaches.add(cache);
+        return cache;
+      });
+    } else {
+      freeHeap.add(new MemorySection(pinnedPoolBase, poolSize));
+      this.threadCaches = null;
+    }
+    this.threadCacheLimit = Math.min(MAX_THREAD_CACHE_BYTES, poolSize / 64);
+    this.availableBytes = new AtomicLong(poolSize);
   }
 
   @Override
   public void close() {
-    assert numAllocatedSections == 0;
+    assert numAllocatedSections.get() == 0;
     Cuda.freePinned(pinnedPoolBase);
   }
 
-  private synchronized HostMemoryBuffer tryAllocateInternal(long bytes) {
+  /**
+   * Index of the size class of an allocation of up to MAX_SIZE_CLASS bytes.
+   */
+  private static int sizeClassOf(long bytes) {
+    if (bytes <= MIN_SIZE_CLASS) {
+      return 0;
+    }
+    // bytes is in (2^log2, 2^(log2 + 1)], split into SIZE_CLASSES_PER_DOUBLING steps
+    int log2 = 63 - Long.numberOfLeadingZeros(bytes - 1);
+    long step = 1L << log2 >> Integer.numberOfTrailingZeros(SIZE_CLASSES_PER_DOUBLING);
+    int stepIndex = (int) ((bytes - (1L << log2) + step - 1) / step) - 1;
+    int doubling = log2 - Long.numberOfTrailingZeros(MIN_SIZE_CLASS);
+    return 1 + doubling * SIZE_CLASSES_PER_DOUBLING + stepIndex;
+  }
+
+  private static long sizeClassSize(int sizeClass) {
+    if (sizeClass == 0) {
+      return MIN_SIZE_CLASS;
+    }
+    int log2 = Long.numberOfTrailingZeros(MIN_SIZE_CLASS) +
+        (sizeClass - 1) / SIZE_CLASSES_PER_DOUBLING;
+    long step = 1L << log2 >> Integer.numberOfTrailingZeros(SIZE_CLASSES_PER_DOUBLING);
+    return (1L << log2) + ((sizeClass - 1) % SIZE_CLASSES_PER_DOUBLING + 1) * step;
+  }
+
+  private HostMemoryBuffer tryAllocateInternal(long bytes) {
+    if (mode == AllocatorMode.SIZE_CLASS) {
+      return tryAllocateSizeClass(bytes);
+    }
+    return tryAllocateFirstFit(bytes);
+  }
+
+  private void free(MemorySection section) {
+    if (mode == AllocatorMode.SIZE_CLASS) {
+      freeSizeClass(section);
+    } else {
+      freeFirstFit(section);
+    }
+  }
+
+  private HostMemoryBuffer tryAllocateSizeClass(long bytes) {
+    MemorySection allocated = allocateSection(bytes);
+    if (allocated == null) {
+      // The free memory may be held by the caches of other threads, or of exited threads
+      drainThreadCaches();
+      allocated = allocateSection(bytes);
+    }
+    if (allocated == null) {
+      log.debug("Insufficient pinned memory. {} needed, {} found", bytes,
+          bestFitHeap.getLargestFreeBlock());
+      return null;
+    }
+    numAllocatedSections.incrementAndGet();
+    availableBytes.addAndGet(-allocated.size);
+    log.trace("Allocated {} outstanding {}", allocated, numAllocatedSections);
+    return new HostMemoryBuffer(allocated.baseAddress, bytes,
+        new PinnedHostBufferCleaner(allocated, bytes));
+  }
+
+  private MemorySection allocateSection(long bytes) {
+    if (bytes == 0) {
+      return new MemorySection(pinnedPoolBase, 0);
+    }
+    if (bytes > MAX_SIZE_CLASS) {
+      return bestFitHeap.allocate(((bytes + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT);
+    }
+    int sizeClass = sizeClassOf(bytes);
+    ThreadCache cache = threadCaches.get();
+    MemorySection cached = cache.take(sizeClass);
+    if (cached != null) {
+      return cached;
+    }
+    // Refill the cache with sections carved out of a single free section
+    long classSize = sizeClassSize(sizeClass);
+    long refillBytes = Math.min(REFILL_BYTES, threadCacheLimit);
+    int refillCount = (int) Math.max(1, Math.min(MAX_REFILL_COUNT, refillBytes / classSize));
+    if (refillCount > 1) {
+      MemorySection refill = bestFitHeap.allocate(classSize * refillCount);
+      if (refill != null) {
+        MemorySection allocated = refill.splitOff(classSize);
+        List<MemorySection> uncached = new ArrayList<>();
+        while (refill != null) {
+          MemorySection section = refill;
+          if (refill.size > classSize) {
+            section = refill.splitOff(classSize);
+          } else {
+            refill = null;
+          }
+          if (!cache.offer(section)) {
+            uncached.add(section);
+          }
+        }
+        if (!uncached.isEmpty()) {
+          bestFitHeap.freeAll(uncached);
+        }
+        return allocated;
+      }
+    }
+    return bestFitHeap.allocate(classSize);
+  }
+
+  private void freeSizeClass(MemorySection section) {
+    log.trace("Freeing {} with {} outstanding", section, numAllocatedSections);
+    availableBytes.addAndGet(section.size);
+    numAllocatedSections.decrementAndGet();
+    if (section.size == 0) {
+      return;
+    }
+    if (section.size <= MAX_SIZE_CLASS && threadCaches.get().offer(section)) {
+      return;
+    }
+    bestFitHeap.free(section);
+  }
+
+  private void drainThreadCaches() {
+    Iterator<ThreadCache> it = allThreadCaches.iterator();
+    while (it.hasNext()) {
+      ThreadCache cache = it.next();
+      // A cache cannot be used again once its thread exited
+      boolean exited = !cache.isOwnerAlive();
+      bestFitHeap.freeAll(cache.drain());
+      if (exited) {
+        it.remove();
+      }
+    }
+  }
+
+  private Metrics getMetricsInternal() {
+    if (mode == AllocatorMode.SIZE_CLASS) {
+      synchronized (bestFitHeap) {
+        return new Metrics(poolSize, poolSize - availableBytes.get(), cachedBytes.get(),
+            bestFitHeap.getFreeBytes(), bestFitHeap.getLargestFreeBlock(),
+            bestFitHeap.getNumFreeBlocks(), numAllocatedSections.get());
+      }
+    }
+    synchronized (this) {
+      long largest = freeHeap.stream().mapToLong(section -> section.size).max().orElse(0);
+      return new Metrics(poolSize, poolSize - availableBytes.get(), 0, availableBytes.get(),
+          largest, freeHeap.size(), numAllocatedSections.get());
+    }
+  }
+
+  private synchronized HostMemoryBuffer tryAllocateFirstFit(long bytes) {
     if (freeHeap.isEmpty()) {
       log.debug("No free pinned memory left");
       return null;
@@ -301,16 +744,16 @@ public final class PinnedMemoryPool implements AutoCloseable {
       allocated = first.splitOff(alignedBytes);
       freeHeap.add(first);
     }
-    numAllocatedSections++;
-    availableBytes -= allocated.size;
+    numAllocatedSections.incrementAndGet();
+    availableBytes.addAndGet(-allocated.size);
     log.debug("Allocated {} free {} outstanding {}", allocated, freeHeap, numAllocatedSections);
     return new HostMemoryBuffer(allocated.baseAddress, bytes,
         new PinnedHostBufferCleaner(allocated, bytes));
   }
 
-  private synchronized void free(MemorySection section) {
+  private synchronized void freeFirstFit(MemorySection section) {
     log.debug("Freeing {} with {} outstanding {}", section, freeHeap, numAllocatedSections);
-    availableBytes += section.size;
+    availableBytes.addAndGet(section.size);
     Iterator<MemorySection> it = freeHeap.iterator();
     while(it.hasNext()) {
       MemorySection current = it.next();
@@ -320,11 +763,11 @@ public final class PinnedMemoryPool implements AutoCloseable {
       }
     }
     freeHeap.add(section);
-    numAllocatedSections--;
+    numAllocatedSections.decrementAndGet();
     log.debug("After freeing {} outstanding {}", freeHeap, numAllocatedSections);
   }
 
-  private synchronized long getAvailableBytesInternal() {
-    return this.availableBytes;
+  private long getAvailableBytesInternal() {
+    return this.availableBytes.get();
   }
 }
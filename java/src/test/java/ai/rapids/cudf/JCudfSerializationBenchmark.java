@@ -0,0 +1,117 @@
+/*
+ *
+ *  Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.IOException;
+
+/**
+ * Measures the host side concatenation of serialized tables, as done when reading shuffled
+ * batches. This is not run as part of the tests, run it with
+ * <pre>
+ * mvn test-compile exec:java -Dexec.classpathScope=test \
+ *   -Dexec.mainClass=ai.rapids.cudf.JCudfSerializationBenchmark \
+ *   -Dexec.args="numTables rowsPerTable"
+ * </pre>
+ * and compare the single threaded concatenation by also passing
+ * -Dai.rapids.cudf.serialization.concatThreads=1.
+ */
+public class JCudfSerializationBenchmark {
+  private static final int WARMUP_ITERATIONS = 5;
+  private static final int MEASURED_ITERATIONS = 20;
+
+  public static void main(String[] args) throws IOException {
+    int numTables = args.length > 0 ? Integer.parseInt(args[0]) : 1000;
+    int rowsPerTable = args.length > 1 ? Integer.parseInt(args[1]) : 10000;
+    System.out.println("Concatenating " + numTables + " tables of " + rowsPerTable + " rows on " +
+        Integer.getInteger("ai.rapids.cudf.serialization.concatThreads",
+            Runtime.getRuntime().availableProcessors()) + " threads");
+    int numRows = numTables * rowsPerTable;
+    try (Scalar zero = Scalar.fromInt(0);
+         Scalar three = Scalar.fromInt(3);
+         Scalar four = Scalar.fromInt(4);
+         Scalar nullString = Scalar.fromNull(DType.STRING);
+         ColumnVector ints = ColumnVector.sequence(zero, numRows);
+         ColumnVector intStrings = ints.castTo(DType.STRING);
+         ColumnVector mod3 = ints.mod(three);
+         ColumnVector isNull = mod3.equalTo(zero);
+         ColumnVector strings = isNull.ifElse(nullString, intStrings);
+         ColumnVector listSizes = ints.mod(four);
+         ColumnVector lists = ColumnVector.sequence(ints, listSizes);
+         ColumnVector structs = ColumnVector.makeStruct(ints, strings, lists);
+         Table stringTable = new Table(ints, strings);
+         Table nestedTable = new Table(lists, structs)) {
+      run("strings", stringTable, numTables, rowsPerTable);
+      run("nested", nestedTable, numTables, rowsPerTable);
+    }
+  }
+
+  private static void run(String name, Table table, int numTables, int rowsPerTable)
+      throws IOException {
+    ByteArrayOutputStream bout = new ByteArrayOutputStream();
+    for (int i = 0; i < numTables; i++) {
+      JCudfSerialization.writeToStream(table, bout, i * rowsPerTable, rowsPerTable);
+    }
+    DataInputStream din = new DataInputStream(new ByteArrayInputStream(bout.toByteArray()));
+    JCudfSerialization.SerializedTableHeader[] headers =
+        new JCudfSerialization.SerializedTableHeader[numTables];
+    HostMemoryBuffer[] buffers = new HostMemoryBuffer[numTables];
+    try {
+      for (int i = 0; i < numTables; i++) {
+        headers[i] = new JCudfSerialization.SerializedTableHeader(din);
+        buffers[i] = HostMemoryBuffer.allocate(headers[i].getDataLen());
+        JCudfSerialization.readTableIntoBuffer(din, headers[i], buffers[i]);
+      }
+
+      long bytes = 0;
+      for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+        try (JCudfSerialization.HostConcatResult result =
+                 JCudfSerialization.concatToHostBuffer(headers, buffers)) {
+          bytes = result.getTableHeader().getDataLen();
+        }
+      }
+      long[] times = new long[MEASURED_ITERATIONS];
+      for (int i = 0; i < MEASURED_ITERATIONS; i++) {
+        long start = System.nanoTime();
+        try (JCudfSerialization.HostConcatResult result =
+                 JCudfSerialization.concatToHostBuffer(headers, buffers)) {
+          times[i] = System.nanoTime() - start;
+        }
+      }
+
+      long total = 0;
+      long min = Long.MAX_VALUE;
+      for (long time : times) {
+        total += time;
+        min = Math.min(min, time);
+      }
+      double avgMs = total / 1e6 / MEASURED_ITERATIONS;
+      System.out.printf("%-8s %10d bytes  avg %9.3f ms  min %9.3f ms  %8.1f MiB/s%n", name, bytes,
+          avgMs, min / 1e6, bytes / (1024.0 * 1024.0) / (avgMs / 1e3));
+    } finally {
+      for (HostMemoryBuffer buffer : buffers) {
+        if (buffer != null) {
+          buffer.close();
+        }
+      }
+    }
+  }
+}
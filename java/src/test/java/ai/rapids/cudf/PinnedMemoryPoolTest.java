@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -23,6 +23,13 @@ import org.junit.jupiter.api.Test;
 import org.slf4j.Logger;
 import org.slf4j.LoggerFactory;
 
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
 import static org.junit.jupiter.api.Assertions.*;
 
 class PinnedMemoryPoolTest extends CudfTestBase {
@@ -131,4 +138,90 @@ class PinnedMemoryPoolTest extends CudfTestBase {
     }
     assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
   }
-}
\ No newline at end of file
+
+  @Test
+  void testSizeClassAllocation() throws Exception {
+    final long poolSize = 4 * 1024 * 1024L;
+    PinnedMemoryPool.initialize(poolSize, -1, PinnedMemoryPool.AllocatorMode.SIZE_CLASS);
+    assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+    try (HostMemoryBuffer small = PinnedMemoryPool.tryAllocate(100);
+         HostMemoryBuffer large = PinnedMemoryPool.tryAllocate(3 * 1024 * 1024 + 1)) {
+      assertNotNull(small);
+      assertNotNull(large);
+      assertEquals(100, small.getLength());
+      // Small allocations are rounded up to a size class, large ones to the alignment
+      assertEquals(poolSize - 112 - (3 * 1024 * 1024 + 8), PinnedMemoryPool.getAvailableBytes());
+      PinnedMemoryPool.Metrics metrics = PinnedMemoryPool.getMetrics();
+      assertEquals(2, metrics.getNumAllocations());
+      assertEquals(poolSize - PinnedMemoryPool.getAvailableBytes(), metrics.getAllocatedBytes());
+      assertTrue(metrics.getOccupancy() > 0.75);
+      assertNull(PinnedMemoryPool.tryAllocate(poolSize));
+    }
+    assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+
+    // Memory freed into the cache of another thread is reclaimed when the pool runs out
+    ExecutorService service = Executors.newSingleThreadExecutor();
+    try {
+      service.submit(() -> {
+        List<HostMemoryBuffer> buffers = new ArrayList<>();
+        HostMemoryBuffer buffer;
+        while ((buffer = PinnedMemoryPool.tryAllocate(1000)) != null) {
+          buffers.add(buffer);
+        }
+        buffers.forEach(HostMemoryBuffer::close);
+      }).get();
+    } finally {
+      service.shutdown();
+    }
+    try (HostMemoryBuffer all = PinnedMemoryPool.tryAllocate(poolSize)) {
+      assertNotNull(all);
+      assertEquals(0, PinnedMemoryPool.getAvailableBytes());
+    }
+    PinnedMemoryPool.Metrics metrics = PinnedMemoryPool.getMetrics();
+    assertEquals(0, metrics.getNumAllocations());
+    assertEquals(1, metrics.getNumFreeBlocks());
+    assertEquals(poolSize, metrics.getLargestFreeBlock());
+    assertEquals(0.0, metrics.getFragmentation());
+  }
+
+  @Test
+  void testSizeClassConcurrentAllocation() throws Exception {
+    final long poolSize = 256 * 1024 * 1024L;
+    PinnedMemoryPool.initialize(poolSize, -1, PinnedMemoryPool.AllocatorMode.SIZE_CLASS);
+    final int numThreads = 8;
+    ExecutorService service = Executors.newFixedThreadPool(numThreads);
+    try {
+      List<Future<?>> futures = new ArrayList<>();
+      for (int t = 0; t < numThreads; t++) {
+        final int seed = t;
+        futures.add(service.submit(() -> {
+          Random random = new Random(seed);
+          List<HostMemoryBuffer> buffers = new ArrayList<>();
+          for (int i = 0; i < 10000; i++) {
+            if (buffers.size() < 16 && random.nextBoolean()) {
+              long size = random.nextInt(10) == 0 ? 1024 * 1024 + 1 : random.nextInt(64 * 1024);
+              HostMemoryBuffer buffer = PinnedMemoryPool.tryAllocate(size);
+              assertNotNull(buffer);
+              assertEquals(size, buffer.getLength());
+              buffers.add(buffer);
+            } else if (!buffers.isEmpty()) {
+              buffers.remove(random.nextInt(buffers.size())).close();
+            }
+          }
+          buffers.forEach(HostMemoryBuffer::close);
+        }));
+      }
+      for (Future<?> future : futures) {
+        future.get();
+      }
+    } finally {
+      service.shutdown();
+    }
+    assertEquals(poolSize, PinnedMemoryPool.getAvailableBytes());
+    // Reclaims the thread caches, coalescing the whole pool
+    try (HostMemoryBuffer all = PinnedMemoryPool.tryAllocate(poolSize)) {
+      assertNotNull(all);
+    }
+    assertEquals(0.0, PinnedMemoryPool.getMetrics().getFragmentation());
+  }
+}
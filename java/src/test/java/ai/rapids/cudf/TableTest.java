@@ -51,6 +51,7 @@ import java.math.BigDecimal;
 import java.math.BigInteger;
 import java.math.RoundingMode;
 import java.nio.ByteBuffer;
+import java.nio.channels.Channels;
 import java.nio.charset.StandardCharsets;
 import java.nio.file.Files;
 import java.util.*;
@@ -3886,6 +3887,57 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testConcatHostLarge() throws IOException {
+    // large enough for the host concatenation to be split across threads
+    final int numRows = 1000000;
+    final int numSlices = 100;
+    try (Scalar zero = Scalar.fromInt(0);
+         Scalar three = Scalar.fromInt(3);
+         Scalar four = Scalar.fromInt(4);
+         Scalar nullString = Scalar.fromNull(DType.STRING);
+         ColumnVector ints = ColumnVector.sequence(zero, numRows);
+         ColumnVector intStrings = ints.castTo(DType.STRING);
+         ColumnVector mod3 = ints.mod(three);
+         ColumnVector isNull = mod3.equalTo(zero);
+         ColumnVector strings = isNull.ifElse(nullString, intStrings);
+         ColumnVector listSizes = ints.mod(four);
+         ColumnVector lists = ColumnVector.sequence(ints, listSizes);
+         ColumnVector structs = ColumnVector.makeStruct(strings, lists);
+         Table t = new Table(ints, strings, lists, structs)) {
+      ByteArrayOutputStream bout = new ByteArrayOutputStream();
+      int sliceRows = numRows / numSlices;
+      for (int i = 0; i < numRows; i += sliceRows) {
+        if (i == numRows / 2) {
+          // empty tables are skipped
+          JCudfSerialization.writeToStream(t, bout, i, 0);
+        }
+        JCudfSerialization.writeToStream(t, bout, i, sliceRows);
+      }
+      DataInputStream din = new DataInputStream(new ByteArrayInputStream(bout.toByteArray()));
+      int numTables = numSlices + 1;
+      JCudfSerialization.SerializedTableHeader[] headers =
+          new JCudfSerialization.SerializedTableHeader[numTables];
+      HostMemoryBuffer[] buffers = new HostMemoryBuffer[numTables];
+      try {
+        for (int i = 0; i < numTables; i++) {
+          headers[i] = new JCudfSerialization.SerializedTableHeader(din);
+          buffers[i] = HostMemoryBuffer.allocate(headers[i].getDataLen());
+          JCudfSerialization.readTableIntoBuffer(din, headers[i], buffers[i]);
+        }
+        try (Table found = JCudfSerialization.readAndConcat(headers, buffers)) {
+          assertTablesAreEqual(t, found);
+        }
+      } finally {
+        for (HostMemoryBuffer buffer : buffers) {
+          if (buffer != null) {
+            buffer.close();
+          }
+        }
+      }
+    }
+  }
+
   @Test
   void testSerializationRoundTripSlicedHostSide() throws IOException {
     try (Table t = buildTestTable()) {
@@ -3959,6 +4011,111 @@ public class TableTest extends CudfTestBase {
     }
   }
 
+  @Test
+  void testSerializationCompressedRoundTrip() throws IOException {
+    try (Table t = buildTestTable()) {
+      for (int sliceAmount = 1; sliceAmount < t.getRowCount(); sliceAmount ++) {
+        ByteArrayOutputStream bout = new ByteArrayOutputStream();
+        for (int i = 0; i < t.getRowCount(); i += sliceAmount) {
+          int len = (int) Math.min(t.getRowCount() - i, sliceAmount);
+          JCudfSerialization.writeToStream(t, bout, i, len, CompressionType.ZIP);
+        }
+        ByteArrayInputStream bin = new ByteArrayInputStream(bout.toByteArray());
+        DataInputStream din = new DataInputStream(bin);
+        ArrayList<JCudfSerialization.SerializedTableHeader> headers = new ArrayList<>();
+        List<HostMemoryBuffer> buffers = new ArrayList<>();
+        try {
+          JCudfSerialization.SerializedTableHeader head;
+          do {
+            head = new JCudfSerialization.SerializedTableHeader(din);
+            if (head.wasInitialized()) {
+              assertEquals(CompressionType.ZIP, head.getCompression());
+              HostMemoryBuffer buff = HostMemoryBuffer.allocate(head.getDataLen());
+              buffers.add(buff);
+              JCudfSerialization.readTableIntoBuffer(din, head, buff);
+              assertTrue(head.wasDataRead());
+              headers.add(head);
+            }
+          } while (head.wasInitialized());
+          JCudfSerialization.SerializedTableHeader[] headerArray =
+              headers.toArray(new JCudfSerialization.SerializedTableHeader[0]);
+          HostMemoryBuffer[] bufferArray = buffers.toArray(new HostMemoryBuffer[0]);
+          try (Table found = JCudfSerialization.readAndConcat(headerArray, bufferArray)) {
+            assertPartialTablesAreEqual(t, 0, t.getRowCount(), found, false, false);
+          }
+          ByteArrayOutputStream concatOut = new ByteArrayOutputStream();
+          JCudfSerialization.writeConcatedStream(headerArray, bufferArray, concatOut,
+              CompressionType.ZIP);
+          ByteArrayInputStream concatIn = new ByteArrayInputStream(concatOut.toByteArray());
+          try (JCudfSerialization.TableAndRowCountPair found =
+                   JCudfSerialization.readTableFrom(concatIn)) {
+            assertPartialTablesAreEqual(t, 0, t.getRowCount(), found.getTable(), false, false);
+          }
+        } finally {
+          for (HostMemoryBuffer buff: buffers) {
+            buff.close();
+          }
+        }
+      }
+    }
+  }
+
+  @Test
+  void testSerializationCompressedStrings() throws IOException {
+    String[] values = new String[100000];
+    for (int i = 0; i < values.length; i++) {
+      values[i] = i % 7 == 0 ? null : "category-" + (i % 13);
+    }
+    try (Table t = new Table.TestBuilder().column(values).build()) {
+      ByteArrayOutputStream uncompressed = new ByteArrayOutputStream();
+      JCudfSerialization.writeToStream(t, uncompressed, 0, t.getRowCount());
+      ByteArrayOutputStream compressed = new ByteArrayOutputStream();
+      JCudfSerialization.writeToStream(t, compressed, 0, t.getRowCount(), CompressionType.ZIP);
+      assertTrue(compressed.size() * 3 < uncompressed.size());
+      byte[] data = compressed.toByteArray();
+      try (JCudfSerialization.TableAndRowCountPair found =
+               JCudfSerialization.readTableFrom(new ByteArrayInputStream(data))) {
+        assertTablesAreEqual(t, found.getTable());
+      }
+      // Corrupt the last compressed byte
+      data[data.length - 1] ^= 0x5a;
+      assertThrows(IOException.class,
+          () -> JCudfSerialization.readTableFrom(new ByteArrayInputStream(data)).close());
+      assertThrows(IllegalArgumentException.class, () -> JCudfSerialization.writeToStream(t,
+          new ByteArrayOutputStream(), 0, t.getRowCount(), CompressionType.SNAPPY));
+    }
+  }
+
+  @Test
+  void testSerializationToChannel() throws IOException {
+    try (Table t = buildTestTable()) {
+      HostColumnVector[] columns = new HostColumnVector[t.getNumberOfColumns()];
+      try {
+        for (int i = 0; i < columns.length; i++) {
+          columns[i] = t.getColumn(i).copyToHost();
+        }
+        for (CompressionType compression : new CompressionType[] {
+            CompressionType.NONE, CompressionType.ZIP}) {
+          ByteArrayOutputStream bout = new ByteArrayOutputStream();
+          JCudfSerialization.writeToChannel(columns, Channels.newChannel(bout), 1,
+              t.getRowCount() - 1, compression);
+          ByteArrayInputStream bin = new ByteArrayInputStream(bout.toByteArray());
+          try (JCudfSerialization.TableAndRowCountPair found =
+                   JCudfSerialization.readTableFrom(bin)) {
+            assertPartialTablesAreEqual(t, 1, t.getRowCount() - 1, found.getTable(), false,
+                false);
+          }
+        }
+      } finally {
+        for (HostColumnVector column : columns) {
+          if (column != null) {
+            column.close();
+          }
+        }
+      }
+    }
+  }
+
   @Test
   void testSerializationReconstructFromMetadata() throws IOException {
     try (Table t = buildTestTable()) {